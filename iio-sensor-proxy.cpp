@@ -10,12 +10,23 @@
  *
  */
 
+#include <errno.h>
+#include <math.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <glib-unix.h>
+#include <gio/gunixfdlist.h>
 #include <gudev/gudev.h>
 
 #include "orientation.h"
+#include "sensor-state.h"
 #include "iio-sensor-proxy-resources.h"
 
 #include "sensorfw-core/console_log.h"
+#include "sensorfw-core/name_table.h"
+#include "sensorfw-core/sample_queue.h"
+#include "sensorfw-core/sample_stream.h"
 #include "sensorfw-core/sensorfw_proximity_sensor.h"
 #include "sensorfw-core/sensorfw_light_sensor.h"
 #include "sensorfw-core/sensorfw_orientation_sensor.h"
@@ -24,11 +35,20 @@
 #define SENSOR_PROXY_DBUS_NAME          "net.hadess.SensorProxy"
 #define SENSOR_PROXY_DBUS_PATH          "/net/hadess/SensorProxy"
 #define SENSOR_PROXY_COMPASS_DBUS_PATH  "/net/hadess/SensorProxy/Compass"
+#define SENSOR_PROXY_BROADCAST_DBUS_PATH SENSOR_PROXY_DBUS_PATH "/Broadcast"
 #define SENSOR_PROXY_IFACE_NAME         SENSOR_PROXY_DBUS_NAME
 #define SENSOR_PROXY_COMPASS_IFACE_NAME SENSOR_PROXY_DBUS_NAME ".Compass"
 
+#define SENSORFW_DBUS_NAME              "com.nokia.SensorService"
+
 #define NUM_SENSOR_TYPES DRIVER_TYPE_PROXIMITY + 1
 
+#define SAMPLE_STREAM_CAPACITY 1024
+#define SAMPLE_QUEUE_SIZE 64
+
+/* Slowest rate a client may ask for with the "max-rate" option, in Hz */
+#define MIN_MAX_RATE 0.001
+
 typedef enum {
 	DRIVER_TYPE_ACCEL,
 	DRIVER_TYPE_LIGHT,
@@ -36,39 +56,133 @@ typedef enum {
 	DRIVER_TYPE_PROXIMITY,
 } DriverType;
 
+/* Samples on their way from the sensorfw reader thread to the main loop */
+struct SensorQueues {
+	sensorfw_proxy::SampleQueue<sensorfw_proxy::OrientationSample, SAMPLE_QUEUE_SIZE> orientation;
+	sensorfw_proxy::SampleQueue<sensorfw_proxy::LightSample, SAMPLE_QUEUE_SIZE> light;
+	sensorfw_proxy::SampleQueue<sensorfw_proxy::CompassSample, SAMPLE_QUEUE_SIZE> compass;
+	sensorfw_proxy::SampleQueue<sensorfw_proxy::ProximitySample, SAMPLE_QUEUE_SIZE> proximity;
+};
+
 typedef struct {
 	GMainLoop *loop;
 	GUdevClient *client;
 	GDBusNodeInfo *introspection_data;
+	GDBusInterfaceInfo *broadcast_interfaces[NUM_SENSOR_TYPES];
 	GDBusConnection *connection;
 	guint name_id;
 	int ret;
 
-	GHashTable   *clients[NUM_SENSOR_TYPES]; /* key = D-Bus name, value = watch ID */
+	GArray       *clients; /* Client records, one per D-Bus name */
+	guint         n_claims[NUM_SENSOR_TYPES];
+	guint         n_broadcast_claims[NUM_SENSOR_TYPES];
+
+	/* Claim calls are only answered once sensord started the sensor */
+	gboolean      starting[NUM_SENSOR_TYPES];
+	GPtrArray    *pending_claims[NUM_SENSOR_TYPES];
+
+	/* Controls shared by all sensor types */
+	std::shared_ptr<sensorfw_proxy::Sensorfw> sensorfw[NUM_SENSOR_TYPES];
+	sensorfw_proxy::HandlerRegistration *registrations[NUM_SENSOR_TYPES];
+	sensorfw_proxy::HandlerRegistration *session_registrations[NUM_SENSOR_TYPES];
+	/* Stalls of the backends that were torn down already */
+	guint         stall_counts[NUM_SENSOR_TYPES];
+	std::shared_ptr<sensorfw_proxy::Log> log;
+	std::weak_ptr<sensorfw_proxy::SensorfwManager> manager;
+	std::vector<std::thread> *backend_threads;
+
+	/* In lazy mode, sensors are only brought up once claimed, and torn
+	 * down again after idle_timeout seconds without claims */
+	gboolean      lazy;
+	guint         idle_timeout;
+	gboolean      creating[NUM_SENSOR_TYPES];
+	guint         idle_ids[NUM_SENSOR_TYPES];
+
+	/* Sensors missing at startup are retried whenever sensord appears */
+	guint         sensord_watch_id;
+
+	/* Latest readings, shared read-only with clients */
+	SensorState *state;
+
+	/* The reader thread queues samples and wakes the main loop up
+	 * through wakeup_fd, at most once until the queues are drained */
+	SensorQueues *queues;
+	int           wakeup_fd;
+	guint         wakeup_id;
+	gint          wakeup_pending;
+
+	/* Full rate sample streams, created on the first OpenStream() */
+	std::shared_ptr<sensorfw_proxy::SampleStream> streams[NUM_SENSOR_TYPES];
+	sensorfw_proxy::HandlerRegistration *stream_registrations[NUM_SENSOR_TYPES];
 
 	/* Orientation */
 	OrientationUp previous_orientation;
+	guint64 previous_orientation_timestamp;
 	gboolean accel_avaliable;
 	std::shared_ptr<sensorfw_proxy::OrientationSensor> orientation_sensor;
 
 	/* Light */
 	gdouble previous_level;
 	gdouble previous_level_accumulator; // light level smoothing
+	guint64 previous_level_timestamp;
 	gboolean uses_lux;
 	gboolean light_avaliable;
 	std::shared_ptr<sensorfw_proxy::LightSensor> light_sensor;
 
 	/* Compass */
 	gdouble previous_heading;
+	guint64 previous_heading_timestamp;
 	gboolean compass_avaliable;
 	std::shared_ptr<sensorfw_proxy::CompassSensor> compass_sensor;
 
 	/* Proximity */
 	gboolean previous_prox_near;
+	guint64 previous_prox_timestamp;
 	gboolean prox_avaliable;
 	std::shared_ptr<sensorfw_proxy::ProximitySensor> proximity_sensor;
 } SensorData;
 
+/* A client's claim on a sensor, along with the limits it asked for
+ * in the Claim*WithOptions() call */
+typedef struct {
+	SensorData *data;
+	const char *name;
+	DriverType driver_type;
+
+	/* Readings are broadcast on the sensor's own object path, the
+	 * limits below only apply to unicast readings */
+	gboolean broadcast;
+
+	/* Notifications are throttled with a token bucket holding
+	 * at most one token, refilled at max_rate per second */
+	gdouble max_rate;
+	gdouble tokens;
+	gint64 last_refill;
+	guint flush_id;
+
+	/* Readings closer than min_delta to the last one sent are skipped */
+	gdouble min_delta;
+	gdouble last_sent;
+	gboolean has_last_sent;
+
+	/* Readings may be delivered in batches of up to buffer_size,
+	 * at least every buffer_interval ms */
+	guint buffer_size;
+	guint buffer_interval;
+
+	/* eventfd of the sample stream the client opened, or -1 */
+	int stream_event_fd;
+} ClientClaim;
+
+/* Everything a D-Bus client claimed. The records are kept in a flat
+ * array so events can be dispatched to clients without allocating */
+typedef struct {
+	char *name; /* unique bus name, claims point to it */
+	guint watch_id;
+	int mask;         /* properties of all the claimed sensors */
+	ClientClaim *claims[NUM_SENSOR_TYPES];
+} Client;
+
 static const char *
 driver_type_to_str (DriverType type)
 {
@@ -86,6 +200,88 @@ driver_type_to_str (DriverType type)
 	}
 }
 
+static const char *
+driver_type_to_stream_name (DriverType type)
+{
+	switch (type) {
+	case DRIVER_TYPE_ACCEL:
+		return "accelerometer";
+	case DRIVER_TYPE_LIGHT:
+		return "light";
+	case DRIVER_TYPE_COMPASS:
+		return "compass";
+	case DRIVER_TYPE_PROXIMITY:
+		return "proximity";
+	default:
+		g_assert_not_reached ();
+	}
+}
+
+static gboolean
+driver_type_from_stream_name (const char *name,
+			      DriverType *driver_type)
+{
+	if (g_strcmp0 (name, "accelerometer") == 0)
+		*driver_type = DRIVER_TYPE_ACCEL;
+	else if (g_strcmp0 (name, "light") == 0)
+		*driver_type = DRIVER_TYPE_LIGHT;
+	else if (g_strcmp0 (name, "compass") == 0)
+		*driver_type = DRIVER_TYPE_COMPASS;
+	else if (g_strcmp0 (name, "proximity") == 0)
+		*driver_type = DRIVER_TYPE_PROXIMITY;
+	else
+		return FALSE;
+	return TRUE;
+}
+
+static const char *
+broadcast_path_for_sensor_type (DriverType type)
+{
+	switch (type) {
+	case DRIVER_TYPE_ACCEL:
+		return SENSOR_PROXY_BROADCAST_DBUS_PATH "/Accelerometer";
+	case DRIVER_TYPE_LIGHT:
+		return SENSOR_PROXY_BROADCAST_DBUS_PATH "/Light";
+	case DRIVER_TYPE_COMPASS:
+		return SENSOR_PROXY_BROADCAST_DBUS_PATH "/Compass";
+	case DRIVER_TYPE_PROXIMITY:
+		return SENSOR_PROXY_BROADCAST_DBUS_PATH "/Proximity";
+	default:
+		g_assert_not_reached ();
+	}
+}
+
+/* The properties the broadcast object of a sensor carries */
+static const char * const *
+broadcast_properties_for_sensor_type (DriverType type)
+{
+	static const char * const accel[] = {
+		"HasAccelerometer", "AccelerometerOrientation", "AccelerometerTimestamp", NULL
+	};
+	static const char * const light[] = {
+		"HasAmbientLight", "LightLevelUnit", "LightLevel", "LightLevelTimestamp", NULL
+	};
+	static const char * const compass[] = {
+		"HasCompass", "CompassHeading", "CompassHeadingTimestamp", NULL
+	};
+	static const char * const proximity[] = {
+		"HasProximity", "ProximityNear", "ProximityTimestamp", NULL
+	};
+
+	switch (type) {
+	case DRIVER_TYPE_ACCEL:
+		return accel;
+	case DRIVER_TYPE_LIGHT:
+		return light;
+	case DRIVER_TYPE_COMPASS:
+		return compass;
+	case DRIVER_TYPE_PROXIMITY:
+		return proximity;
+	default:
+		g_assert_not_reached ();
+	}
+}
+
 static gboolean
 driver_type_exists (SensorData *data,
 		    DriverType  driver_type)
@@ -106,20 +302,108 @@ driver_type_exists (SensorData *data,
 }
 
 static void
-free_client_watch (gpointer data)
+set_driver_type_available (SensorData *data,
+			   DriverType  driver_type)
+{
+	switch (driver_type) {
+	case DRIVER_TYPE_ACCEL:
+		data->accel_avaliable = TRUE;
+		break;
+	case DRIVER_TYPE_LIGHT:
+		data->light_avaliable = TRUE;
+		break;
+	case DRIVER_TYPE_COMPASS:
+		data->compass_avaliable = TRUE;
+		break;
+	case DRIVER_TYPE_PROXIMITY:
+		data->prox_avaliable = TRUE;
+		break;
+	}
+}
+
+static void
+publish_sensor_state (SensorData *data,
+		      DriverType  driver_type)
 {
-	guint watch_id = GPOINTER_TO_UINT (data);
+	guint32 flags = 0;
 
-	if (watch_id == 0)
+	if (data->state == NULL)
 		return;
-	g_bus_unwatch_name (watch_id);
+
+	if (driver_type_exists (data, driver_type))
+		flags |= SENSOR_STATE_FLAG_AVAILABLE;
+
+	switch (driver_type) {
+	case DRIVER_TYPE_ACCEL:
+		sensor_state_update (data->state, SENSOR_STATE_SLOT_ACCEL, flags,
+				     data->previous_orientation_timestamp,
+				     data->previous_orientation, 0);
+		break;
+	case DRIVER_TYPE_LIGHT:
+		if (data->uses_lux)
+			flags |= SENSOR_STATE_FLAG_LUX;
+		sensor_state_update (data->state, SENSOR_STATE_SLOT_LIGHT, flags,
+				     data->previous_level_timestamp,
+				     data->previous_level,
+				     data->previous_level_accumulator);
+		break;
+	case DRIVER_TYPE_COMPASS:
+		sensor_state_update (data->state, SENSOR_STATE_SLOT_COMPASS, flags,
+				     data->previous_heading_timestamp,
+				     data->previous_heading, 0);
+		break;
+	case DRIVER_TYPE_PROXIMITY:
+		sensor_state_update (data->state, SENSOR_STATE_SLOT_PROXIMITY, flags,
+				     data->previous_prox_timestamp,
+				     data->previous_prox_near, 0);
+		break;
+	}
+}
+
+static void
+free_client_claim (ClientClaim *claim)
+{
+	if (claim->flush_id != 0)
+		g_source_remove (claim->flush_id);
+	if (claim->stream_event_fd >= 0)
+		claim->data->streams[claim->driver_type]->remove_reader (claim->stream_event_fd);
+	g_free (claim);
+}
+
+static void
+clear_client (gpointer data)
+{
+	Client *client = (Client *) data;
+	guint i;
+
+	if (client->watch_id != 0)
+		g_bus_unwatch_name (client->watch_id);
+	for (i = 0; i < NUM_SENSOR_TYPES; i++)
+		g_clear_pointer (&client->claims[i], free_client_claim);
+	g_clear_pointer (&client->name, g_free);
+}
+
+static GArray *
+create_clients_array (void)
+{
+	GArray *clients;
+
+	clients = g_array_new (FALSE, TRUE, sizeof (Client));
+	g_array_set_clear_func (clients, clear_client);
+	return clients;
 }
 
-static GHashTable *
-create_clients_hash_table (void)
+static gint
+find_client (SensorData *data,
+	     const char *name)
 {
-	return g_hash_table_new_full (g_str_hash, g_str_equal,
-				      g_free, free_client_watch);
+	guint i;
+
+	for (i = 0; i < data->clients->len; i++) {
+		if (g_strcmp0 (g_array_index (data->clients, Client, i).name, name) == 0)
+			return i;
+	}
+	return -1;
 }
 
 enum {
@@ -142,68 +426,249 @@ enum {
 #define PROP_ALL_COMPASS (PROP_HAS_COMPASS | \
 			  PROP_COMPASS_HEADING)
 
+typedef struct {
+	SensorData *data;
+	DriverType driver_type;
+	gboolean success;
+} SensorStarted;
+
+static gboolean
+sensor_started_cb (gpointer user_data)
+{
+	SensorStarted *started = (SensorStarted *) user_data;
+	SensorData *data = started->data;
+	GPtrArray *pending = data->pending_claims[started->driver_type];
+	guint i;
+
+	/* The claims stay valid, readings will come in if the
+	 * sensor gets started later on */
+	if (!started->success)
+		g_warning ("Could not start %s sensor", driver_type_to_str (started->driver_type));
+
+	data->starting[started->driver_type] = FALSE;
+	for (i = 0; i < pending->len; i++)
+		g_dbus_method_invocation_return_value ((GDBusMethodInvocation *) g_ptr_array_index (pending, i), NULL);
+	g_ptr_array_set_size (pending, 0);
+
+	g_free (started);
+	return G_SOURCE_REMOVE;
+}
+
+/* The sensor is started from its own event loop, hand the result
+ * back to the main loop */
+static sensorfw_proxy::CompletionHandler
+sensor_started_handler (SensorData *data,
+			DriverType  driver_type)
+{
+	return [data, driver_type](bool success) {
+		SensorStarted *started = g_new0 (SensorStarted, 1);
+
+		started->data = data;
+		started->driver_type = driver_type;
+		started->success = success;
+		g_idle_add (sensor_started_cb, started);
+	};
+}
+
+static void bring_up_sensor (SensorData *data, DriverType driver_type);
+
 static void
 enable_sensorfw_events (SensorData *data,
 			DriverType sensor_type)
 {
+	if (!driver_type_exists (data, sensor_type))
+		return;
+
+	if (data->idle_ids[sensor_type] != 0) {
+		g_source_remove (data->idle_ids[sensor_type]);
+		data->idle_ids[sensor_type] = 0;
+	}
+
+	data->starting[sensor_type] = TRUE;
+
+	/* The sensor gets started once it is up */
+	if (!data->sensorfw[sensor_type]) {
+		bring_up_sensor (data, sensor_type);
+		return;
+	}
+
 	switch (sensor_type) {
 	case DRIVER_TYPE_ACCEL:
-		if (data->accel_avaliable) {
-			g_debug ("Enabling orientation sensor");
-			data->orientation_sensor->enable_orientation_events ();
-		}
+		g_debug ("Enabling orientation sensor");
+		data->orientation_sensor->enable_orientation_events (sensor_started_handler (data, sensor_type));
 		break;
 	case DRIVER_TYPE_LIGHT:
-		if (data->light_avaliable) {
-			g_debug ("Enabling ambient light sensor");
-			data->light_sensor->enable_light_events ();
-		}
+		g_debug ("Enabling ambient light sensor");
+		data->light_sensor->enable_light_events (sensor_started_handler (data, sensor_type));
 		break;
 	case DRIVER_TYPE_COMPASS:
-		if (data->compass_avaliable) {
-			g_debug ("Enabling compass sensor");
-			data->compass_sensor->enable_compass_events ();
-		}
+		g_debug ("Enabling compass sensor");
+		data->compass_sensor->enable_compass_events (sensor_started_handler (data, sensor_type));
 		break;
 	case DRIVER_TYPE_PROXIMITY:
-		if (data->prox_avaliable) {
-			g_debug ("Enabling proximity sensor");
-			data->proximity_sensor->enable_proximity_events ();
-		}
+		g_debug ("Enabling proximity sensor");
+		data->proximity_sensor->enable_proximity_events (sensor_started_handler (data, sensor_type));
 		break;
 	}
 }
 
 static void
-disable_sensorfw_events (SensorData *data,
-			 DriverType sensor_type)
+disable_sensorfw_events (SensorData                              *data,
+			 DriverType                               sensor_type,
+			 sensorfw_proxy::CompletionHandler const &done)
 {
+	if (!data->sensorfw[sensor_type])
+		return;
+
 	switch (sensor_type) {
 	case DRIVER_TYPE_ACCEL:
 		if (data->accel_avaliable) {
 			g_debug ("Disabling orientation sensor");
-			data->orientation_sensor->disable_orientation_events ();
+			data->orientation_sensor->disable_orientation_events (done);
 		}
 		break;
 	case DRIVER_TYPE_LIGHT:
 		if (data->light_avaliable) {
 			g_debug ("Disabling ambient light sensor");
-			data->light_sensor->disable_light_events ();
+			data->light_sensor->disable_light_events (done);
 		}
 		break;
 	case DRIVER_TYPE_COMPASS:
 		if (data->compass_avaliable) {
 			g_debug ("Disabling compass sensor");
-			data->compass_sensor->disable_compass_events ();
+			data->compass_sensor->disable_compass_events (done);
 		}
 		break;
 	case DRIVER_TYPE_PROXIMITY:
 		if (data->prox_avaliable) {
 			g_debug ("Disabling proximity sensor");
-			data->proximity_sensor->disable_proximity_events ();
+			data->proximity_sensor->disable_proximity_events (done);
+		}
+		break;
+	}
+}
+
+static gboolean
+main_loop_call_cb (gpointer user_data)
+{
+	auto const callback = static_cast<std::function<void()> *> (user_data);
+
+	(*callback) ();
+	delete callback;
+
+	return G_SOURCE_REMOVE;
+}
+
+/* Can be called from any thread */
+static void
+invoke_on_main_loop (std::function<void()> const &callback)
+{
+	g_idle_add (main_loop_call_cb, new std::function<void()> (callback));
+}
+
+static void
+join_backend_thread (SensorData      *data,
+		     std::thread::id  id)
+{
+	auto &threads = *data->backend_threads;
+
+	for (auto it = threads.begin (); it != threads.end (); ++it) {
+		if (it->get_id () == id) {
+			it->join ();
+			threads.erase (it);
+			return;
 		}
+	}
+}
+
+/* Creating and destroying backends waits for sensord, so it is done on
+ * threads of their own. They are joined once done, or at exit. The work
+ * is moved over, whatever it holds is only released on the thread */
+static void
+run_backend_thread (SensorData            *data,
+		    std::function<void()>  work)
+{
+	data->backend_threads->emplace_back ([data, work = std::move (work)] {
+		auto const id = std::this_thread::get_id ();
+
+		work ();
+		invoke_on_main_loop ([data, id] { join_backend_thread (data, id); });
+	});
+}
+
+static void
+detach_sensor (SensorData *data,
+	       DriverType  driver_type)
+{
+	delete data->registrations[driver_type];
+	data->registrations[driver_type] = NULL;
+	delete data->session_registrations[driver_type];
+	data->session_registrations[driver_type] = NULL;
+	delete data->stream_registrations[driver_type];
+	data->stream_registrations[driver_type] = NULL;
+}
+
+typedef struct {
+	SensorData *data;
+	DriverType driver_type;
+} SensorKey;
+
+static gboolean
+tear_down_sensor_cb (gpointer user_data)
+{
+	SensorKey *key = (SensorKey *) user_data;
+	SensorData *data = key->data;
+	DriverType driver_type = key->driver_type;
+	std::shared_ptr<sensorfw_proxy::Sensorfw> sensor;
+
+	data->idle_ids[driver_type] = 0;
+	if (data->n_claims[driver_type] > 0 || !data->sensorfw[driver_type])
+		return G_SOURCE_REMOVE;
+
+	g_debug ("Tearing down idle %s sensor", driver_type_to_str (driver_type));
+
+	detach_sensor (data, driver_type);
+	sensor = std::move (data->sensorfw[driver_type]);
+	data->stall_counts[driver_type] += sensor->stall_count ();
+	switch (driver_type) {
+	case DRIVER_TYPE_ACCEL:
+		data->orientation_sensor.reset ();
+		break;
+	case DRIVER_TYPE_LIGHT:
+		data->light_sensor.reset ();
+		break;
+	case DRIVER_TYPE_COMPASS:
+		data->compass_sensor.reset ();
+		break;
+	case DRIVER_TYPE_PROXIMITY:
+		data->proximity_sensor.reset ();
 		break;
 	}
+
+	/* Releasing the session waits for sensord, the last reference is
+	 * handed to the thread so that it is dropped there */
+	run_backend_thread (data, [sensor = std::move (sensor)] () mutable { sensor.reset (); });
+
+	return G_SOURCE_REMOVE;
+}
+
+static void
+schedule_sensor_tear_down (SensorData *data,
+			   DriverType  driver_type)
+{
+	SensorKey *key;
+
+	if (data->idle_ids[driver_type] != 0)
+		return;
+
+	key = g_new0 (SensorKey, 1);
+	key->data = data;
+	key->driver_type = driver_type;
+	data->idle_ids[driver_type] = g_timeout_add_seconds_full (G_PRIORITY_DEFAULT,
+								  data->idle_timeout,
+								  tear_down_sensor_cb,
+								  key,
+								  g_free);
 }
 
 static int
@@ -227,16 +692,15 @@ mask_for_sensor_type (DriverType sensor_type)
 	}
 }
 
-static void
-send_dbus_event_for_client (SensorData     *data,
-			    const char     *destination_bus_name,
-			    int  mask)
+/* Builds the PropertiesChanged body for mask, already serialized so
+ * it can be sent to any number of clients without converting it again */
+static GVariant *
+build_properties_changed (SensorData *data,
+			  int         mask)
 {
 	GVariantBuilder props_builder;
 	GVariant *props_changed = NULL;
 
-	g_return_if_fail (destination_bus_name != NULL);
-
 	g_variant_builder_init (&props_builder, G_VARIANT_TYPE ("a{sv}"));
 
 	if (mask & PROP_HAS_ACCELEROMETER) {
@@ -256,6 +720,8 @@ send_dbus_event_for_client (SensorData     *data,
 	if (mask & PROP_ACCELEROMETER_ORIENTATION) {
 		g_variant_builder_add (&props_builder, "{sv}", "AccelerometerOrientation",
 				       g_variant_new_string (orientation_to_string (data->previous_orientation)));
+		g_variant_builder_add (&props_builder, "{sv}", "AccelerometerTimestamp",
+				       g_variant_new_uint64 (data->previous_orientation_timestamp));
 	}
 
 	if (mask & PROP_HAS_AMBIENT_LIGHT) {
@@ -275,8 +741,8 @@ send_dbus_event_for_client (SensorData     *data,
 				       g_variant_new_string (data->uses_lux ? "lux" : "vendor"));
 		g_variant_builder_add (&props_builder, "{sv}", "LightLevel",
 				       g_variant_new_double (data->previous_level));
-		g_variant_builder_add (&props_builder, "{sv}", "LightLevelAccumulator",
-+                                      g_variant_new_double (data->previous_level_accumulator));
+		g_variant_builder_add (&props_builder, "{sv}", "LightLevelTimestamp",
+				       g_variant_new_uint64 (data->previous_level_timestamp));
 	}
 
 	if (mask & PROP_HAS_COMPASS) {
@@ -294,6 +760,8 @@ send_dbus_event_for_client (SensorData     *data,
 	if (mask & PROP_COMPASS_HEADING) {
 		g_variant_builder_add (&props_builder, "{sv}", "CompassHeading",
 				       g_variant_new_double (data->previous_heading));
+		g_variant_builder_add (&props_builder, "{sv}", "CompassHeadingTimestamp",
+				       g_variant_new_uint64 (data->previous_heading_timestamp));
 	}
 
 	if (mask & PROP_HAS_PROXIMITY) {
@@ -311,82 +779,341 @@ send_dbus_event_for_client (SensorData     *data,
 	if (mask & PROP_PROXIMITY_NEAR) {
 		g_variant_builder_add (&props_builder, "{sv}", "ProximityNear",
 				       g_variant_new_boolean (data->previous_prox_near));
+		g_variant_builder_add (&props_builder, "{sv}", "ProximityTimestamp",
+				       g_variant_new_uint64 (data->previous_prox_timestamp));
 	}
 
 	props_changed = g_variant_new ("(s@a{sv}@as)", (mask & PROP_ALL) ? SENSOR_PROXY_IFACE_NAME : SENSOR_PROXY_COMPASS_IFACE_NAME,
 				       g_variant_builder_end (&props_builder),
 				       g_variant_new_strv (NULL, 0));
+	g_variant_ref_sink (props_changed);
+	g_variant_get_data (props_changed);
+
+	return props_changed;
+}
 
+static void
+emit_properties_changed (SensorData *data,
+			 const char *destination_bus_name,
+			 const char *object_path,
+			 GVariant   *props_changed)
+{
 	g_dbus_connection_emit_signal (data->connection,
 				       destination_bus_name,
-				       (mask & PROP_ALL) ? SENSOR_PROXY_DBUS_PATH : SENSOR_PROXY_COMPASS_DBUS_PATH,
+				       object_path,
 				       "org.freedesktop.DBus.Properties",
 				       "PropertiesChanged",
 				       props_changed, NULL);
 }
 
 static void
-send_dbus_event (SensorData     *data,
-		 int             mask)
+send_dbus_event_for_client (SensorData     *data,
+			    const char     *destination_bus_name,
+			    int  mask)
 {
-	GHashTable *ht;
-	guint i;
-	GHashTableIter iter;
-	gpointer key, value;
-
-	g_assert (mask != 0);
-	g_assert ((mask & PROP_ALL) == 0 || (mask & PROP_ALL_COMPASS) == 0);
+	GVariant *props_changed;
 
-	if (data->connection == NULL)
-		return;
-
-	/* Make a list of the events each client for each sensor
-	 * is interested in */
-	ht = g_hash_table_new (g_str_hash, g_str_equal);
-	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
-		GList *clients, *l;
+	g_return_if_fail (destination_bus_name != NULL);
 
-		clients = g_hash_table_get_keys (data->clients[i]);
-		for (l = clients; l != NULL; l = l->next) {
-			int m, new_mask;
+	props_changed = build_properties_changed (data, mask);
+	emit_properties_changed (data, destination_bus_name,
+				 (mask & PROP_ALL) ? SENSOR_PROXY_DBUS_PATH : SENSOR_PROXY_COMPASS_DBUS_PATH,
+				 props_changed);
+	g_variant_unref (props_changed);
+}
 
-			/* Already have a mask? */
-			m = GPOINTER_TO_UINT (g_hash_table_lookup (ht, l->data));
-			new_mask = mask & mask_for_sensor_type ((DriverType) i);
-			m |= new_mask;
-			g_hash_table_insert (ht, l->data, GUINT_TO_POINTER (m));
-		}
+static int
+reading_mask_for_sensor_type (DriverType sensor_type)
+{
+	switch (sensor_type) {
+	case DRIVER_TYPE_ACCEL:
+		return PROP_ACCELEROMETER_ORIENTATION;
+	case DRIVER_TYPE_LIGHT:
+		return PROP_LIGHT_LEVEL;
+	case DRIVER_TYPE_COMPASS:
+		return PROP_COMPASS_HEADING;
+	case DRIVER_TYPE_PROXIMITY:
+		return PROP_PROXIMITY_NEAR;
+	default:
+		g_assert_not_reached ();
 	}
-
-	g_hash_table_iter_init (&iter, ht);
-	while (g_hash_table_iter_next (&iter, &key, &value))
-		send_dbus_event_for_client (data, (const char *) key, GPOINTER_TO_UINT (value));
-	g_hash_table_destroy (ht);
 }
 
-static void
-client_release (SensorData            *data,
-		const char            *sender,
-		DriverType             driver_type)
+static gdouble
+current_reading (SensorData *data,
+		 DriverType  sensor_type)
 {
-	GHashTable *ht;
-	guint watch_id;
+	switch (sensor_type) {
+	case DRIVER_TYPE_ACCEL:
+		return data->previous_orientation;
+	case DRIVER_TYPE_LIGHT:
+		return data->previous_level;
+	case DRIVER_TYPE_COMPASS:
+		return data->previous_heading;
+	case DRIVER_TYPE_PROXIMITY:
+		return data->previous_prox_near;
+	default:
+		g_assert_not_reached ();
+	}
+}
 
-	ht = data->clients[driver_type];
+static gboolean
+client_reading_changed (ClientClaim *client)
+{
+	gdouble value, delta;
 
-	watch_id = GPOINTER_TO_UINT (g_hash_table_lookup (ht, sender));
-	if (watch_id == 0)
-		return;
+	if (!client->has_last_sent)
+		return TRUE;
 
-	g_hash_table_remove (ht, sender);
+	value = current_reading (client->data, client->driver_type);
+	delta = fabs (value - client->last_sent);
 
-	/* Disable sensorfw events if no one is interested */
-	if (g_hash_table_size (ht) == 0)
-		disable_sensorfw_events (data, driver_type);
+	switch (client->driver_type) {
+	case DRIVER_TYPE_LIGHT:
+		return delta > 0 && delta >= client->min_delta;
+	case DRIVER_TYPE_COMPASS:
+		delta = MIN (delta, 360 - delta);
+		return delta > 0 && delta >= client->min_delta;
+	default:
+		/* Orientation and proximity only ever change in whole steps */
+		return delta > 0;
+	}
 }
 
 static void
-client_vanished_cb (GDBusConnection *connection,
+client_refill_tokens (ClientClaim *client)
+{
+	gint64 now;
+
+	now = g_get_monotonic_time ();
+	client->tokens = MIN (1.0, client->tokens + client->max_rate * (now - client->last_refill) / G_USEC_PER_SEC);
+	client->last_refill = now;
+}
+
+static void
+client_sent_reading (ClientClaim *client)
+{
+	client->last_sent = current_reading (client->data, client->driver_type);
+	client->has_last_sent = TRUE;
+	if (client->max_rate > 0)
+		client->tokens -= 1.0;
+}
+
+static gboolean
+client_flush_cb (gpointer user_data)
+{
+	ClientClaim *client = (ClientClaim *) user_data;
+
+	client->flush_id = 0;
+	client_refill_tokens (client);
+
+	if (client_reading_changed (client)) {
+		client_sent_reading (client);
+		send_dbus_event_for_client (client->data, client->name,
+					    reading_mask_for_sensor_type (client->driver_type));
+	}
+
+	return G_SOURCE_REMOVE;
+}
+
+/* Drops the reading from the mask if the client does not want to hear
+ * about it yet. Readings held back by the rate limit are sent once the
+ * bucket has refilled, so the client never ends up with a stale value */
+static int
+client_filter_mask (ClientClaim *client,
+		    int         mask)
+{
+	int reading_mask;
+
+	if (client->max_rate <= 0 && client->min_delta <= 0)
+		return mask;
+
+	reading_mask = reading_mask_for_sensor_type (client->driver_type);
+	if ((mask & reading_mask) == 0)
+		return mask;
+
+	/* The sensor just appeared, send everything */
+	if (mask & ~reading_mask)
+		goto send;
+
+	if (client->flush_id != 0 || !client_reading_changed (client))
+		return mask & ~reading_mask;
+
+	if (client->max_rate > 0) {
+		client_refill_tokens (client);
+		if (client->tokens < 1.0) {
+			gdouble wait_ms;
+			guint interval;
+
+			wait_ms = ceil ((1.0 - client->tokens) * 1000 / client->max_rate);
+			interval = wait_ms < G_MAXUINT ? (guint) wait_ms : G_MAXUINT;
+			client->flush_id = g_timeout_add (interval, client_flush_cb, client);
+			return mask & ~reading_mask;
+		}
+	}
+
+send:
+	client_sent_reading (client);
+	return mask;
+}
+
+#define MAX_CACHED_BODIES 8
+
+static void
+send_dbus_event (SensorData     *data,
+		 int             mask)
+{
+	struct {
+		int mask;
+		GVariant *body;
+	} bodies[MAX_CACHED_BODIES];
+	guint n_bodies = 0;
+	GVariant *body;
+	guint i, j;
+
+	g_assert (mask != 0);
+	g_assert ((mask & PROP_ALL) == 0 || (mask & PROP_ALL_COMPASS) == 0);
+
+	if (data->connection == NULL)
+		return;
+
+	/* One signal for all the clients that asked for broadcasts */
+	for (j = 0; j < NUM_SENSOR_TYPES; j++) {
+		int m;
+
+		m = mask & mask_for_sensor_type ((DriverType) j);
+		if (m == 0 || data->n_broadcast_claims[j] == 0)
+			continue;
+
+		body = build_properties_changed (data, m);
+		emit_properties_changed (data, NULL, broadcast_path_for_sensor_type ((DriverType) j), body);
+		g_variant_unref (body);
+	}
+
+	for (i = 0; i < data->clients->len; i++) {
+		Client *client = &g_array_index (data->clients, Client, i);
+		int m = 0;
+
+		if ((client->mask & mask) == 0)
+			continue;
+
+		/* Collect the events the client is interested in for
+		 * each sensor it claimed */
+		for (j = 0; j < NUM_SENSOR_TYPES; j++) {
+			if (client->claims[j] == NULL || client->claims[j]->broadcast)
+				continue;
+			m |= client_filter_mask (client->claims[j],
+						 mask & mask_for_sensor_type ((DriverType) j));
+		}
+
+		if (m == 0)
+			continue;
+
+		/* Most clients want the same properties, build each
+		 * body once and send the same one to all of them */
+		for (j = 0; j < n_bodies; j++) {
+			if (bodies[j].mask == m)
+				break;
+		}
+
+		if (j < n_bodies) {
+			body = bodies[j].body;
+		} else if (n_bodies < MAX_CACHED_BODIES) {
+			bodies[n_bodies].mask = m;
+			bodies[n_bodies].body = build_properties_changed (data, m);
+			body = bodies[n_bodies++].body;
+		} else {
+			send_dbus_event_for_client (data, client->name, m);
+			continue;
+		}
+
+		emit_properties_changed (data, client->name,
+					 (m & PROP_ALL) ? SENSOR_PROXY_DBUS_PATH : SENSOR_PROXY_COMPASS_DBUS_PATH,
+					 body);
+	}
+
+	for (j = 0; j < n_bodies; j++)
+		g_variant_unref (bodies[j].body);
+}
+
+/* Only sample as fast as the most demanding client needs, and only
+ * buffer readings if every client is fine with getting them late */
+static void
+update_sensor_settings (SensorData *data,
+			DriverType  driver_type)
+{
+	gdouble fastest = 0;
+	gboolean unlimited = FALSE;
+	guint buffer_size = G_MAXUINT, buffer_interval = G_MAXUINT;
+	guint i;
+
+	if (!driver_type_exists (data, driver_type) || !data->sensorfw[driver_type])
+		return;
+
+	for (i = 0; i < data->clients->len; i++) {
+		ClientClaim *claim = g_array_index (data->clients, Client, i).claims[driver_type];
+
+		if (claim == NULL)
+			continue;
+
+		/* Someone wants every reading, use the default rate */
+		if (claim->max_rate <= 0)
+			unlimited = TRUE;
+		fastest = MAX (fastest, claim->max_rate);
+
+		buffer_size = MIN (buffer_size, claim->buffer_size);
+		if (claim->buffer_interval > 0)
+			buffer_interval = MIN (buffer_interval, claim->buffer_interval);
+	}
+
+	if (unlimited)
+		fastest = 0;
+	if (buffer_size == G_MAXUINT || buffer_size <= 1)
+		buffer_size = 0;
+	if (buffer_size == 0 || buffer_interval == G_MAXUINT)
+		buffer_interval = 0;
+
+	data->sensorfw[driver_type]->set_interval (fastest > 0 ? MAX (1, (int) (1000 / fastest)) : 0);
+	data->sensorfw[driver_type]->set_buffering (buffer_size, buffer_interval);
+}
+
+static void
+client_release (SensorData            *data,
+		const char            *sender,
+		DriverType             driver_type)
+{
+	Client *client;
+	gint index;
+
+	index = find_client (data, sender);
+	if (index < 0)
+		return;
+
+	client = &g_array_index (data->clients, Client, index);
+	if (client->claims[driver_type] == NULL)
+		return;
+
+	if (client->claims[driver_type]->broadcast)
+		data->n_broadcast_claims[driver_type]--;
+	g_clear_pointer (&client->claims[driver_type], free_client_claim);
+	client->mask &= ~mask_for_sensor_type (driver_type);
+
+	/* Forget about clients that do not claim anything anymore */
+	if (client->mask == 0)
+		g_array_remove_index_fast (data->clients, index);
+
+	/* Disable sensorfw events if no one is interested */
+	if (--data->n_claims[driver_type] == 0) {
+		disable_sensorfw_events (data, driver_type, nullptr);
+		if (data->lazy)
+			schedule_sensor_tear_down (data, driver_type);
+	}
+
+	update_sensor_settings (data, driver_type);
+}
+
+static void
+client_vanished_cb (GDBusConnection *connection,
 		    const gchar     *name,
 		    gpointer         user_data)
 {
@@ -399,66 +1126,377 @@ client_vanished_cb (GDBusConnection *connection,
 
 	sender = g_strdup (name);
 
-	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
-		GHashTable *ht;
-		guint watch_id;
+	for (i = 0; i < NUM_SENSOR_TYPES; i++)
+		client_release (data, sender, (DriverType) i);
 
-		ht = data->clients[i];
-		g_assert (ht);
+	g_free (sender);
+}
 
-		watch_id = GPOINTER_TO_UINT (g_hash_table_lookup (ht, sender));
-		if (watch_id > 0)
-			client_release(data, sender, (DriverType) i);
+/* Registers the sender as a client of the sensor, or updates its options
+ * if it already is one */
+static gboolean
+client_claim (SensorData  *data,
+	      const char  *sender,
+	      DriverType   driver_type,
+	      GVariant    *options,
+	      GError     **error)
+{
+	Client *client;
+	ClientClaim *claim;
+	gint index;
+	gdouble max_rate = 0, min_delta = 0;
+	guint buffer_size = 0, buffer_interval = 0;
+	gboolean broadcast = FALSE;
+
+	if (options != NULL) {
+		g_variant_lookup (options, "broadcast", "b", &broadcast);
+		g_variant_lookup (options, "max-rate", "d", &max_rate);
+		g_variant_lookup (options, "min-delta", "d", &min_delta);
+		g_variant_lookup (options, "buffer-size", "u", &buffer_size);
+		g_variant_lookup (options, "buffer-interval", "u", &buffer_interval);
+
+		if (!isfinite (max_rate) || !isfinite (min_delta) ||
+		    max_rate < 0 || min_delta < 0) {
+			g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS,
+				     "Options 'max-rate' and 'min-delta' must be finite and cannot be negative");
+			return FALSE;
+		}
+		if (max_rate > 0 && max_rate < MIN_MAX_RATE) {
+			g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS,
+				     "Option 'max-rate' must be 0 or at least %g", MIN_MAX_RATE);
+			return FALSE;
+		}
 	}
 
-	g_free (sender);
+	index = find_client (data, sender);
+	if (index < 0) {
+		Client new_client = {};
+
+		new_client.name = g_strdup (sender);
+		new_client.watch_id = g_bus_watch_name_on_connection (data->connection,
+								      sender,
+								      G_BUS_NAME_WATCHER_FLAGS_NONE,
+								      NULL,
+								      client_vanished_cb,
+								      data,
+								      NULL);
+		g_array_append_val (data->clients, new_client);
+		index = data->clients->len - 1;
+	}
+	client = &g_array_index (data->clients, Client, index);
+
+	claim = client->claims[driver_type];
+	if (claim != NULL) {
+		/* Claiming again only updates the options */
+		if (claim->broadcast != broadcast) {
+			if (broadcast)
+				data->n_broadcast_claims[driver_type]++;
+			else
+				data->n_broadcast_claims[driver_type]--;
+			claim->broadcast = broadcast;
+		}
+		claim->max_rate = max_rate;
+		claim->min_delta = min_delta;
+		claim->buffer_size = buffer_size;
+		claim->buffer_interval = buffer_interval;
+		update_sensor_settings (data, driver_type);
+		return TRUE;
+	}
+
+	/* Ensure events are enabled if no one claimed the sensor yet, or
+	 * its backend could not be brought up for the earlier claims */
+	if (data->n_claims[driver_type]++ == 0 || !data->sensorfw[driver_type])
+		enable_sensorfw_events (data, driver_type);
+
+	claim = g_new0 (ClientClaim, 1);
+	claim->data = data;
+	claim->name = client->name;
+	claim->driver_type = driver_type;
+	claim->broadcast = broadcast;
+	claim->max_rate = max_rate;
+	claim->tokens = 1.0;
+	claim->last_refill = g_get_monotonic_time ();
+	claim->min_delta = min_delta;
+	claim->buffer_size = buffer_size;
+	claim->buffer_interval = buffer_interval;
+	claim->stream_event_fd = -1;
+
+	client->claims[driver_type] = claim;
+	client->mask |= mask_for_sensor_type (driver_type);
+	if (broadcast)
+		data->n_broadcast_claims[driver_type]++;
+	update_sensor_settings (data, driver_type);
+
+	return TRUE;
 }
 
+/* The claim owns the eventfd of the stream the client opened, opening the
+ * stream again replaces it */
+static void
+client_set_stream_reader (SensorData *data,
+			  const char *sender,
+			  DriverType  driver_type,
+			  int         event_fd)
+{
+	Client *client = &g_array_index (data->clients, Client, find_client (data, sender));
+	ClientClaim *claim = client->claims[driver_type];
+
+	if (claim->stream_event_fd >= 0)
+		data->streams[driver_type]->remove_reader (claim->stream_event_fd);
+	claim->stream_event_fd = event_fd;
+}
+
+typedef enum {
+	METHOD_CLAIM,
+	METHOD_CLAIM_WITH_OPTIONS,
+	METHOD_RELEASE,
+	METHOD_OPEN_STATE_PAGE,
+	METHOD_OPEN_STREAM,
+} MethodAction;
+
+typedef struct {
+	MethodAction action;
+	DriverType driver_type;
+} MethodTarget;
+
 static void
 handle_generic_method_call (SensorData            *data,
 			    const gchar           *sender,
-			    const gchar           *object_path,
-			    const gchar           *interface_name,
 			    const gchar           *method_name,
 			    GVariant              *parameters,
 			    GDBusMethodInvocation *invocation,
-			    DriverType             driver_type)
+			    MethodTarget           target)
 {
-	GHashTable *ht;
-	guint watch_id;
+	DriverType driver_type = target.driver_type;
 
 	g_debug ("Handling driver refcounting method '%s' for %s device",
 		 method_name, driver_type_to_str (driver_type));
 
-	ht = data->clients[driver_type];
+	if (target.action == METHOD_CLAIM ||
+	    target.action == METHOD_CLAIM_WITH_OPTIONS) {
+		GVariant *options = NULL;
+		GError *error = NULL;
 
-	if (g_str_has_prefix (method_name, "Claim")) {
-		watch_id = GPOINTER_TO_UINT (g_hash_table_lookup (ht, sender));
-		if (watch_id > 0) {
-			g_dbus_method_invocation_return_value (invocation, NULL);
-			return;
-		}
-
-		/* Ensure events are enabled if the hashtable is currently empty */
-		if (g_hash_table_size (ht) == 0)
-			enable_sensorfw_events (data, driver_type);
+		if (target.action == METHOD_CLAIM_WITH_OPTIONS)
+			g_variant_get (parameters, "(@a{sv})", &options);
 
-		watch_id = g_bus_watch_name_on_connection (data->connection,
-							   sender,
-							   G_BUS_NAME_WATCHER_FLAGS_NONE,
-							   NULL,
-							   client_vanished_cb,
-							   data,
-							   NULL);
-		g_hash_table_insert (ht, g_strdup (sender), GUINT_TO_POINTER (watch_id));
+		if (!client_claim (data, sender, driver_type, options, &error))
+			g_dbus_method_invocation_take_error (invocation, error);
+		else if (data->starting[driver_type])
+			g_ptr_array_add (data->pending_claims[driver_type], invocation);
+		else
+			g_dbus_method_invocation_return_value (invocation, NULL);
 
-		g_dbus_method_invocation_return_value (invocation, NULL);
-	} else if (g_str_has_prefix (method_name, "Release")) {
+		g_clear_pointer (&options, g_variant_unref);
+	} else if (target.action == METHOD_RELEASE) {
 		client_release (data, sender, driver_type);
 		g_dbus_method_invocation_return_value (invocation, NULL);
 	}
 }
 
+static void
+handle_open_state_page (SensorData            *data,
+			GDBusMethodInvocation *invocation)
+{
+	GUnixFDList *fd_list;
+	GError *error = NULL;
+	gint index;
+
+	if (data->state == NULL) {
+		g_dbus_method_invocation_return_error (invocation,
+						       G_DBUS_ERROR,
+						       G_DBUS_ERROR_NOT_SUPPORTED,
+						       "No sensor state page available");
+		return;
+	}
+
+	fd_list = g_unix_fd_list_new ();
+	index = g_unix_fd_list_append (fd_list, sensor_state_get_fd (data->state), &error);
+	if (index < 0) {
+		g_dbus_method_invocation_take_error (invocation, error);
+		g_object_unref (fd_list);
+		return;
+	}
+
+	g_dbus_method_invocation_return_value_with_unix_fd_list (invocation,
+								 g_variant_new ("(h)", index),
+								 fd_list);
+	g_object_unref (fd_list);
+}
+
+template<typename Sample, typename Convert>
+static std::function<void(sensorfw_proxy::SampleSpan<Sample> const &)>
+stream_batch_handler (std::shared_ptr<sensorfw_proxy::SampleStream> const &stream,
+		      Convert                                               convert)
+{
+	return [stream, convert](sensorfw_proxy::SampleSpan<Sample> const &samples) {
+		for (auto const &sample : samples)
+			stream->push (sample.timestamp, convert (sample.value));
+		stream->notify ();
+	};
+}
+
+/* Samples are written to the stream straight from the sensorfw reader
+ * thread, the main loop is not involved once the stream exists */
+static void
+register_stream_handler (SensorData *data,
+			 DriverType  driver_type)
+{
+	std::shared_ptr<sensorfw_proxy::SampleStream> const &stream = data->streams[driver_type];
+	sensorfw_proxy::HandlerRegistration registration;
+
+	/* Registered once the sensor is up in lazy mode */
+	if (!stream || !data->sensorfw[driver_type] || data->stream_registrations[driver_type])
+		return;
+
+	switch (driver_type) {
+	case DRIVER_TYPE_ACCEL:
+		registration = data->orientation_sensor->register_orientation_batch_handler (
+			stream_batch_handler<sensorfw_proxy::OrientationSample> (stream,
+				[](sensorfw_proxy::OrientationData value) { return (double) value; }));
+		break;
+	case DRIVER_TYPE_LIGHT:
+		registration = data->light_sensor->register_light_batch_handler (
+			stream_batch_handler<sensorfw_proxy::LightSample> (stream,
+				[](double value) { return value; }));
+		break;
+	case DRIVER_TYPE_COMPASS:
+		registration = data->compass_sensor->register_compass_batch_handler (
+			stream_batch_handler<sensorfw_proxy::CompassSample> (stream,
+				[](double value) { return value; }));
+		break;
+	case DRIVER_TYPE_PROXIMITY:
+		registration = data->proximity_sensor->register_proximity_batch_handler (
+			stream_batch_handler<sensorfw_proxy::ProximitySample> (stream,
+				[](sensorfw_proxy::ProximityState value) {
+					return value == sensorfw_proxy::ProximityState::near ? 1.0 : 0.0;
+				}));
+		break;
+	}
+
+	data->stream_registrations[driver_type] = new sensorfw_proxy::HandlerRegistration (std::move (registration));
+}
+
+static gboolean
+ensure_sample_stream (SensorData  *data,
+		      DriverType   driver_type,
+		      GError     **error)
+{
+	if (data->streams[driver_type])
+		return TRUE;
+
+	try
+	{
+		data->streams[driver_type] = std::make_shared<sensorfw_proxy::SampleStream>(SAMPLE_STREAM_CAPACITY);
+	}
+	catch (std::exception const &e)
+	{
+		g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_FAILED, "%s", e.what ());
+		return FALSE;
+	}
+
+	register_stream_handler (data, driver_type);
+
+	return TRUE;
+}
+
+static void
+handle_open_stream (SensorData            *data,
+		    const gchar           *sender,
+		    GVariant              *parameters,
+		    GDBusMethodInvocation *invocation)
+{
+	const char *name;
+	GVariant *options;
+	DriverType driver_type;
+	GUnixFDList *fd_list = NULL;
+	GError *error = NULL;
+	gint ring_index, event_index;
+	int event_fd = -1;
+
+	g_variant_get (parameters, "(&s@a{sv})", &name, &options);
+
+	if (!driver_type_from_stream_name (name, &driver_type)) {
+		g_set_error (&error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS,
+			     "Unknown sensor '%s'", name);
+		goto out;
+	}
+
+	if (!driver_type_exists (data, driver_type)) {
+		g_set_error (&error, G_DBUS_ERROR, G_DBUS_ERROR_NOT_SUPPORTED,
+			     "No %s available", driver_type_to_str (driver_type));
+		goto out;
+	}
+
+	if (!ensure_sample_stream (data, driver_type, &error))
+		goto out;
+
+	/* Each client gets an eventfd of its own, so reading it does not
+	 * swallow the wakeups of the others */
+	try
+	{
+		event_fd = data->streams[driver_type]->add_reader ();
+	}
+	catch (std::exception const &e)
+	{
+		g_set_error (&error, G_DBUS_ERROR, G_DBUS_ERROR_FAILED, "%s", e.what ());
+		goto out;
+	}
+
+	fd_list = g_unix_fd_list_new ();
+	ring_index = g_unix_fd_list_append (fd_list, data->streams[driver_type]->ring_fd (), &error);
+	if (ring_index < 0)
+		goto out;
+	event_index = g_unix_fd_list_append (fd_list, event_fd, &error);
+	if (event_index < 0)
+		goto out;
+
+	/* Streaming clients are regular clients, Release*() stops signalling
+	 * the client's eventfd */
+	if (!client_claim (data, sender, driver_type, options, &error))
+		goto out;
+
+	client_set_stream_reader (data, sender, driver_type, event_fd);
+	event_fd = -1;
+
+	g_dbus_method_invocation_return_value_with_unix_fd_list (invocation,
+								 g_variant_new ("(hh)", ring_index, event_index),
+								 fd_list);
+
+out:
+	if (error != NULL)
+		g_dbus_method_invocation_take_error (invocation, error);
+	if (event_fd >= 0)
+		data->streams[driver_type]->remove_reader (event_fd);
+	g_clear_object (&fd_list);
+	g_variant_unref (options);
+}
+
+/* Names are looked up through perfect hashes built at compile time, some
+ * clients poll the properties very often */
+static constexpr sensorfw_proxy::NameEntry<MethodTarget> method_entries[] = {
+	{ "ClaimAccelerometer", { METHOD_CLAIM, DRIVER_TYPE_ACCEL } },
+	{ "ClaimAccelerometerWithOptions", { METHOD_CLAIM_WITH_OPTIONS, DRIVER_TYPE_ACCEL } },
+	{ "ReleaseAccelerometer", { METHOD_RELEASE, DRIVER_TYPE_ACCEL } },
+	{ "ClaimLight", { METHOD_CLAIM, DRIVER_TYPE_LIGHT } },
+	{ "ClaimLightWithOptions", { METHOD_CLAIM_WITH_OPTIONS, DRIVER_TYPE_LIGHT } },
+	{ "ReleaseLight", { METHOD_RELEASE, DRIVER_TYPE_LIGHT } },
+	{ "ClaimProximity", { METHOD_CLAIM, DRIVER_TYPE_PROXIMITY } },
+	{ "ClaimProximityWithOptions", { METHOD_CLAIM_WITH_OPTIONS, DRIVER_TYPE_PROXIMITY } },
+	{ "ReleaseProximity", { METHOD_RELEASE, DRIVER_TYPE_PROXIMITY } },
+	/* The driver type is not used by these */
+	{ "OpenStatePage", { METHOD_OPEN_STATE_PAGE, DRIVER_TYPE_ACCEL } },
+	{ "OpenStream", { METHOD_OPEN_STREAM, DRIVER_TYPE_ACCEL } },
+};
+static constexpr auto methods = sensorfw_proxy::make_name_table (method_entries);
+
+static constexpr sensorfw_proxy::NameEntry<MethodTarget> compass_method_entries[] = {
+	{ "ClaimCompass", { METHOD_CLAIM, DRIVER_TYPE_COMPASS } },
+	{ "ClaimCompassWithOptions", { METHOD_CLAIM_WITH_OPTIONS, DRIVER_TYPE_COMPASS } },
+	{ "ReleaseCompass", { METHOD_RELEASE, DRIVER_TYPE_COMPASS } },
+};
+static constexpr auto compass_methods = sensorfw_proxy::make_name_table (compass_method_entries);
+
 static void
 handle_method_call (GDBusConnection       *connection,
 		    const gchar           *sender,
@@ -470,18 +1508,9 @@ handle_method_call (GDBusConnection       *connection,
 		    gpointer               user_data)
 {
 	SensorData *data = (SensorData *) user_data;
-	DriverType driver_type;
+	const MethodTarget *target = methods.find (method_name);
 
-	if (g_strcmp0 (method_name, "ClaimAccelerometer") == 0 ||
-	    g_strcmp0 (method_name, "ReleaseAccelerometer") == 0)
-		driver_type = DRIVER_TYPE_ACCEL;
-	else if (g_strcmp0 (method_name, "ClaimLight") == 0 ||
-		 g_strcmp0 (method_name, "ReleaseLight") == 0)
-		driver_type = DRIVER_TYPE_LIGHT;
-	else if (g_strcmp0 (method_name, "ClaimProximity") == 0 ||
-		 g_strcmp0 (method_name, "ReleaseProximity") == 0)
-	        driver_type = DRIVER_TYPE_PROXIMITY;
-	else {
+	if (target == NULL) {
 		g_dbus_method_invocation_return_error (invocation,
 						       G_DBUS_ERROR,
 						       G_DBUS_ERROR_UNKNOWN_METHOD,
@@ -490,11 +1519,75 @@ handle_method_call (GDBusConnection       *connection,
 		return;
 	}
 
-	handle_generic_method_call (data, sender, object_path,
-				    interface_name, method_name,
-				    parameters, invocation, driver_type);
+	switch (target->action) {
+	case METHOD_OPEN_STATE_PAGE:
+		handle_open_state_page (data, invocation);
+		break;
+	case METHOD_OPEN_STREAM:
+		handle_open_stream (data, sender, parameters, invocation);
+		break;
+	default:
+		handle_generic_method_call (data, sender, method_name,
+					    parameters, invocation, *target);
+		break;
+	}
 }
 
+static GVariant *
+build_stream_stalls (SensorData *data)
+{
+	GVariantBuilder builder;
+	guint i;
+
+	g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{su}"));
+	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
+		guint stalls = data->stall_counts[i];
+
+		if (data->sensorfw[i])
+			stalls += data->sensorfw[i]->stall_count ();
+		g_variant_builder_add (&builder, "{su}", driver_type_to_stream_name ((DriverType) i), stalls);
+	}
+
+	return g_variant_builder_end (&builder);
+}
+
+typedef GVariant *(*PropertyGetter) (SensorData *data);
+
+static constexpr sensorfw_proxy::NameEntry<PropertyGetter> property_entries[] = {
+	{ "HasAccelerometer", [](SensorData *data) {
+		return g_variant_new_boolean (driver_type_exists (data, DRIVER_TYPE_ACCEL)); } },
+	{ "AccelerometerOrientation", [](SensorData *data) {
+		return g_variant_new_string (orientation_to_string (data->previous_orientation)); } },
+	{ "AccelerometerTimestamp", [](SensorData *data) {
+		return g_variant_new_uint64 (data->previous_orientation_timestamp); } },
+	{ "HasAmbientLight", [](SensorData *data) {
+		return g_variant_new_boolean (driver_type_exists (data, DRIVER_TYPE_LIGHT)); } },
+	{ "LightLevelUnit", [](SensorData *data) {
+		return g_variant_new_string (data->uses_lux ? "lux" : "vendor"); } },
+	{ "LightLevel", [](SensorData *data) {
+		return g_variant_new_double (data->previous_level); } },
+	{ "LightLevelTimestamp", [](SensorData *data) {
+		return g_variant_new_uint64 (data->previous_level_timestamp); } },
+	{ "HasProximity", [](SensorData *data) {
+		return g_variant_new_boolean (driver_type_exists (data, DRIVER_TYPE_PROXIMITY)); } },
+	{ "ProximityNear", [](SensorData *data) {
+		return g_variant_new_boolean (data->previous_prox_near); } },
+	{ "ProximityTimestamp", [](SensorData *data) {
+		return g_variant_new_uint64 (data->previous_prox_timestamp); } },
+	{ "StreamStalls", build_stream_stalls },
+};
+static constexpr auto properties = sensorfw_proxy::make_name_table (property_entries);
+
+static constexpr sensorfw_proxy::NameEntry<PropertyGetter> compass_property_entries[] = {
+	{ "HasCompass", [](SensorData *data) {
+		return g_variant_new_boolean (driver_type_exists (data, DRIVER_TYPE_COMPASS)); } },
+	{ "CompassHeading", [](SensorData *data) {
+		return g_variant_new_double (data->previous_heading); } },
+	{ "CompassHeadingTimestamp", [](SensorData *data) {
+		return g_variant_new_uint64 (data->previous_heading_timestamp); } },
+};
+static constexpr auto compass_properties = sensorfw_proxy::make_name_table (compass_property_entries);
+
 static GVariant *
 handle_get_property (GDBusConnection *connection,
 		     const gchar     *sender,
@@ -505,28 +1598,13 @@ handle_get_property (GDBusConnection *connection,
 		     gpointer         user_data)
 {
 	SensorData *data = (SensorData *) user_data;
+	const PropertyGetter *getter;
 
 	if (data->connection == NULL)
 		return NULL;
 
-	if (g_strcmp0 (property_name, "HasAccelerometer") == 0)
-		return g_variant_new_boolean (driver_type_exists (data, DRIVER_TYPE_ACCEL));
-	if (g_strcmp0 (property_name, "AccelerometerOrientation") == 0)
-		return g_variant_new_string (orientation_to_string (data->previous_orientation));
-	if (g_strcmp0 (property_name, "HasAmbientLight") == 0)
-		return g_variant_new_boolean (driver_type_exists (data, DRIVER_TYPE_LIGHT));
-	if (g_strcmp0 (property_name, "LightLevelUnit") == 0)
-		return g_variant_new_string (data->uses_lux ? "lux" : "vendor");
-	if (g_strcmp0 (property_name, "LightLevel") == 0)
-		return g_variant_new_double (data->previous_level);
-	if (g_strcmp0 (property_name, "LightLevelAccumulator") == 0)
-+               return g_variant_new_double (data->previous_level_accumulator);
-	if (g_strcmp0 (property_name, "HasProximity") == 0)
-		return g_variant_new_boolean (driver_type_exists (data, DRIVER_TYPE_PROXIMITY));
-	if (g_strcmp0 (property_name, "ProximityNear") == 0)
-		return g_variant_new_boolean (data->previous_prox_near);
-
-	return NULL;
+	getter = properties.find (property_name);
+	return getter ? (*getter) (data) : NULL;
 }
 
 static const GDBusInterfaceVTable interface_vtable =
@@ -547,9 +1625,9 @@ handle_compass_method_call (GDBusConnection       *connection,
 			    gpointer               user_data)
 {
 	SensorData *data = (SensorData *) user_data;
+	const MethodTarget *target = compass_methods.find (method_name);
 
-	if (g_strcmp0 (method_name, "ClaimCompass") != 0 &&
-	    g_strcmp0 (method_name, "ReleaseCompass") != 0) {
+	if (target == NULL) {
 		g_dbus_method_invocation_return_error (invocation,
 						       G_DBUS_ERROR,
 						       G_DBUS_ERROR_UNKNOWN_METHOD,
@@ -558,9 +1636,8 @@ handle_compass_method_call (GDBusConnection       *connection,
 		return;
 	}
 
-	handle_generic_method_call (data, sender, object_path,
-				    interface_name, method_name,
-				    parameters, invocation, DRIVER_TYPE_COMPASS);
+	handle_generic_method_call (data, sender, method_name,
+				    parameters, invocation, *target);
 }
 
 static GVariant *
@@ -573,16 +1650,13 @@ handle_compass_get_property (GDBusConnection *connection,
 			     gpointer         user_data)
 {
 	SensorData *data = (SensorData *) user_data;
+	const PropertyGetter *getter;
 
 	if (data->connection == NULL)
 		return NULL;
 
-	if (g_strcmp0 (property_name, "HasCompass") == 0)
-		return g_variant_new_boolean (driver_type_exists (data, DRIVER_TYPE_COMPASS));
-	if (g_strcmp0 (property_name, "CompassHeading") == 0)
-		return g_variant_new_double (data->previous_heading);
-
-	return NULL;
+	getter = compass_properties.find (property_name);
+	return getter ? (*getter) (data) : NULL;
 }
 
 static const GDBusInterfaceVTable compass_interface_vtable =
@@ -592,6 +1666,77 @@ static const GDBusInterfaceVTable compass_interface_vtable =
 	NULL
 };
 
+static void
+handle_broadcast_method_call (GDBusConnection       *connection,
+			      const gchar           *sender,
+			      const gchar           *object_path,
+			      const gchar           *interface_name,
+			      const gchar           *method_name,
+			      GVariant              *parameters,
+			      GDBusMethodInvocation *invocation,
+			      gpointer               user_data)
+{
+	g_dbus_method_invocation_return_error (invocation,
+					       G_DBUS_ERROR,
+					       G_DBUS_ERROR_UNKNOWN_METHOD,
+					       "Method '%s' does not exist on object %s",
+					       method_name, object_path);
+}
+
+static GVariant *
+handle_broadcast_get_property (GDBusConnection *connection,
+			       const gchar     *sender,
+			       const gchar     *object_path,
+			       const gchar     *interface_name,
+			       const gchar     *property_name,
+			       GError         **error,
+			       gpointer         user_data)
+{
+	SensorData *data = (SensorData *) user_data;
+	const PropertyGetter *getter;
+
+	if (data->connection == NULL)
+		return NULL;
+
+	getter = properties.find (property_name);
+	if (getter == NULL)
+		getter = compass_properties.find (property_name);
+	return getter ? (*getter) (data) : NULL;
+}
+
+static const GDBusInterfaceVTable broadcast_interface_vtable =
+{
+	handle_broadcast_method_call,
+	handle_broadcast_get_property,
+	NULL
+};
+
+/* Broadcast objects only carry the properties of their own sensor,
+ * under the name of the interface the sensor belongs to, and no methods */
+static GDBusInterfaceInfo *
+build_broadcast_interface (GDBusInterfaceInfo *iface,
+			   DriverType          type)
+{
+	const char * const *names = broadcast_properties_for_sensor_type (type);
+	GDBusInterfaceInfo *info;
+	guint i;
+
+	info = g_new0 (GDBusInterfaceInfo, 1);
+	info->ref_count = 1;
+	info->name = g_strdup (iface->name);
+	info->properties = g_new0 (GDBusPropertyInfo *, g_strv_length ((gchar **) names) + 1);
+
+	for (i = 0; names[i] != NULL; i++) {
+		GDBusPropertyInfo *property;
+
+		property = g_dbus_interface_info_lookup_property (iface, names[i]);
+		g_assert (property != NULL);
+		info->properties[i] = g_dbus_property_info_ref (property);
+	}
+
+	return info;
+}
+
 static void
 name_lost_handler (GDBusConnection *connection,
 		   const gchar     *name,
@@ -623,6 +1768,7 @@ bus_acquired_handler (GDBusConnection *connection,
 		      gpointer         user_data)
 {
 	SensorData *data = (SensorData *)user_data;
+	guint i;
 
 	g_dbus_connection_register_object (connection,
 					   SENSOR_PROXY_DBUS_PATH,
@@ -640,6 +1786,16 @@ bus_acquired_handler (GDBusConnection *connection,
 					   NULL,
 					   NULL);
 
+	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
+		g_dbus_connection_register_object (connection,
+						   broadcast_path_for_sensor_type ((DriverType) i),
+						   data->broadcast_interfaces[i],
+						   &broadcast_interface_vtable,
+						   data,
+						   NULL,
+						   NULL);
+	}
+
 	data->connection = (GDBusConnection *) g_object_ref(connection);
 }
 
@@ -660,11 +1816,6 @@ name_acquired_handler (GDBusConnection *connection,
 		       gpointer         user_data)
 {
 	SensorData *data = (SensorData *)user_data;
-	guint i;
-
-	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
-		data->clients[i] = create_clients_hash_table ();
-	}
 
 	send_sensor_availability (data);
 
@@ -681,6 +1832,7 @@ static gboolean
 setup_dbus (SensorData *data)
 {
 	GBytes *bytes;
+	guint i;
 
 	bytes = g_resources_lookup_data ("/net/hadess/SensorProxy/net.hadess.SensorProxy.xml",
 					 G_RESOURCE_LOOKUP_FLAGS_NONE,
@@ -689,6 +1841,14 @@ setup_dbus (SensorData *data)
 	g_bytes_unref (bytes);
 	g_assert (data->introspection_data != NULL);
 
+	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
+		gboolean compass = (i == DRIVER_TYPE_COMPASS);
+
+		data->broadcast_interfaces[i] =
+			build_broadcast_interface (data->introspection_data->interfaces[compass ? 1 : 0],
+						   (DriverType) i);
+	}
+
 	data->name_id = g_bus_own_name (G_BUS_TYPE_SYSTEM,
 					SENSOR_PROXY_DBUS_NAME,
 					G_BUS_NAME_OWNER_FLAGS_NONE,
@@ -709,15 +1869,60 @@ free_sensor_data (SensorData *data)
 	if (data == NULL)
 		return;
 
+	/* Backends still coming up or releasing their session refer to
+	 * the data and keep the manager alive */
+	if (data->backend_threads != NULL) {
+		for (auto &thread : *data->backend_threads)
+			thread.join ();
+		delete data->backend_threads;
+		data->backend_threads = NULL;
+	}
+
 	if (data->name_id != 0) {
 		g_bus_unown_name (data->name_id);
 		data->name_id = 0;
 	}
 
+	if (data->sensord_watch_id != 0) {
+		g_bus_unwatch_name (data->sensord_watch_id);
+		data->sensord_watch_id = 0;
+	}
+
+	g_clear_pointer (&data->clients, g_array_unref);
+
 	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
-		g_clear_pointer (&data->clients[i], g_hash_table_unref);
+		GPtrArray *pending = data->pending_claims[i];
+
+		while (pending != NULL && pending->len > 0) {
+			g_dbus_method_invocation_return_error ((GDBusMethodInvocation *) g_ptr_array_steal_index_fast (pending, 0),
+							       G_DBUS_ERROR, G_DBUS_ERROR_FAILED,
+							       "Sensor proxy is shutting down");
+		}
+		g_clear_pointer (&data->pending_claims[i], g_ptr_array_unref);
+
+		if (data->idle_ids[i] != 0) {
+			g_source_remove (data->idle_ids[i]);
+			data->idle_ids[i] = 0;
+		}
+
+		/* Stop the reader thread from queueing samples before the
+		 * queues go away */
+		detach_sensor (data, (DriverType) i);
+		data->streams[i].reset ();
 	}
 
+	if (data->wakeup_id != 0) {
+		g_source_remove (data->wakeup_id);
+		data->wakeup_id = 0;
+	}
+	if (data->wakeup_fd >= 0)
+		close (data->wakeup_fd);
+	delete data->queues;
+	data->queues = NULL;
+
+	g_clear_pointer (&data->state, sensor_state_free);
+	for (i = 0; i < NUM_SENSOR_TYPES; i++)
+		g_clear_pointer (&data->broadcast_interfaces[i], g_dbus_interface_info_unref);
 	g_clear_pointer (&data->introspection_data, g_dbus_node_info_unref);
 	g_clear_object (&data->connection);
 	g_clear_object (&data->client);
@@ -725,15 +1930,452 @@ free_sensor_data (SensorData *data)
 	g_free (data);
 }
 
+static void
+handle_proximity_sample (SensorData                            *data,
+			 sensorfw_proxy::ProximitySample const &sample)
+{
+	data->previous_prox_near = (sample.value == sensorfw_proxy::ProximityState::near);
+	data->previous_prox_timestamp = sample.timestamp;
+	publish_sensor_state (data, DRIVER_TYPE_PROXIMITY);
+	send_dbus_event (data, PROP_PROXIMITY_NEAR);
+}
+
+static void
+handle_light_sample (SensorData                        *data,
+		     sensorfw_proxy::LightSample const &sample)
+{
+	static double light_accumulator = 0.0f;
+	static double alpha = 0.5f;
+	double light = sample.value;
+
+	if (data->previous_level != light) {
+		light_accumulator = (1 - alpha) * light_accumulator + alpha * light;
+		data->previous_level_accumulator = light_accumulator;
+
+		data->previous_level = light;
+		data->previous_level_timestamp = sample.timestamp;
+		publish_sensor_state (data, DRIVER_TYPE_LIGHT);
+		send_dbus_event (data, PROP_LIGHT_LEVEL);
+	}
+}
+
+static void
+handle_orientation_sample (SensorData                              *data,
+			   sensorfw_proxy::OrientationSample const &sample)
+{
+	OrientationUp orientation = data->previous_orientation;
+
+	switch (sample.value)
+	{
+	case sensorfw_proxy::OrientationData::LeftUp:
+		orientation = ORIENTATION_LEFT_UP;
+		break;
+	case sensorfw_proxy::OrientationData::RightUp:
+		orientation = ORIENTATION_RIGHT_UP;
+		break;
+	case sensorfw_proxy::OrientationData::BottomUp:
+		orientation = ORIENTATION_BOTTOM_UP;
+		break;
+	case sensorfw_proxy::OrientationData::BottomDown:
+		orientation = ORIENTATION_NORMAL;
+		break;
+	case sensorfw_proxy::OrientationData::FaceDown:
+	case sensorfw_proxy::OrientationData::FaceUp:
+		/* Skip FaceDown/FaceUp events */
+		break;
+	default:
+		orientation = ORIENTATION_UNDEFINED;
+		break;
+	}
+
+	if (data->previous_orientation != orientation) {
+		data->previous_orientation = orientation;
+		data->previous_orientation_timestamp = sample.timestamp;
+		publish_sensor_state (data, DRIVER_TYPE_ACCEL);
+		send_dbus_event (data, PROP_ACCELEROMETER_ORIENTATION);
+	}
+}
+
+static void
+handle_compass_sample (SensorData                          *data,
+		       sensorfw_proxy::CompassSample const &sample)
+{
+	int heading = sample.value;
+
+	if (data->previous_heading != heading) {
+		data->previous_heading = heading;
+		data->previous_heading_timestamp = sample.timestamp;
+		publish_sensor_state (data, DRIVER_TYPE_COMPASS);
+		send_dbus_event (data, PROP_COMPASS_HEADING);
+	}
+}
+
+/* Called from the sensorfw reader thread, after queueing a sample */
+static void
+wake_main_loop (SensorData *data)
+{
+	static const guint64 one = 1;
+
+	/* The main loop was already woken up and has not drained the
+	 * queues yet, it will pick this sample up too */
+	if (!g_atomic_int_compare_and_exchange (&data->wakeup_pending, 0, 1))
+		return;
+
+	if (write (data->wakeup_fd, &one, sizeof (one)) < 0)
+		g_warning ("Could not wake up the main loop: %s", g_strerror (errno));
+}
+
+/* Only the latest of the queued samples is of interest, every sensor
+ * gets handled at most once per wakeup however many arrived */
+template<typename Sample, std::size_t N>
+static gboolean
+drain_sample_queue (sensorfw_proxy::SampleQueue<Sample, N> &queue,
+		    Sample                                 &latest)
+{
+	gboolean found = FALSE;
+
+	while (queue.pop (latest))
+		found = TRUE;
+
+	return found;
+}
+
+static gboolean
+sample_queues_cb (gint         fd,
+		  GIOCondition condition,
+		  gpointer     user_data)
+{
+	SensorData *data = (SensorData *) user_data;
+	guint64 count;
+	sensorfw_proxy::ProximitySample proximity;
+	sensorfw_proxy::LightSample light;
+	sensorfw_proxy::OrientationSample orientation;
+	sensorfw_proxy::CompassSample compass;
+
+	if (read (fd, &count, sizeof (count)) < 0 && errno != EAGAIN)
+		g_warning ("Could not read sample queue wakeup: %s", g_strerror (errno));
+
+	/* Samples queued from now on need another wakeup */
+	g_atomic_int_set (&data->wakeup_pending, 0);
+
+	if (drain_sample_queue (data->queues->proximity, proximity))
+		handle_proximity_sample (data, proximity);
+	if (drain_sample_queue (data->queues->light, light))
+		handle_light_sample (data, light);
+	if (drain_sample_queue (data->queues->orientation, orientation))
+		handle_orientation_sample (data, orientation);
+	if (drain_sample_queue (data->queues->compass, compass))
+		handle_compass_sample (data, compass);
+
+	return G_SOURCE_CONTINUE;
+}
+
+static gboolean
+setup_sample_queues (SensorData *data)
+{
+	data->wakeup_fd = eventfd (0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (data->wakeup_fd < 0) {
+		g_warning ("Could not create sample queue wakeup: %s", g_strerror (errno));
+		return FALSE;
+	}
+
+	data->queues = new SensorQueues;
+	data->wakeup_id = g_unix_fd_add (data->wakeup_fd, G_IO_IN, sample_queues_cb, data);
+
+	return TRUE;
+}
+
+/* sensord restarted and lost its state, clients may have missed
+ * readings while the session was being set up again */
+static void
+sensor_session_restored (SensorData *data,
+			 DriverType  driver_type)
+{
+	if (!data->sensorfw[driver_type])
+		return;
+
+	g_debug ("Restored sensord session of %s sensor", driver_type_to_str (driver_type));
+	publish_sensor_state (data, driver_type);
+	send_dbus_event (data, mask_for_sensor_type (driver_type));
+}
+
+/* Hands the sensor's samples over to the main loop */
+static void
+attach_sensor (SensorData *data,
+	       DriverType  driver_type)
+{
+	sensorfw_proxy::HandlerRegistration registration;
+
+	if (!data->sensorfw[driver_type] || data->registrations[driver_type])
+		return;
+
+	switch (driver_type) {
+	case DRIVER_TYPE_ACCEL:
+		registration = data->orientation_sensor->register_orientation_handler(
+			[data](sensorfw_proxy::OrientationSample const &sample) {
+				data->queues->orientation.push(sample);
+				wake_main_loop(data);
+			});
+		break;
+	case DRIVER_TYPE_LIGHT:
+		registration = data->light_sensor->register_light_handler(
+			[data](sensorfw_proxy::LightSample const &sample) {
+				data->queues->light.push(sample);
+				wake_main_loop(data);
+			});
+		break;
+	case DRIVER_TYPE_COMPASS:
+		registration = data->compass_sensor->register_compass_handler(
+			[data](sensorfw_proxy::CompassSample const &sample) {
+				data->queues->compass.push(sample);
+				wake_main_loop(data);
+			});
+		break;
+	case DRIVER_TYPE_PROXIMITY:
+		registration = data->proximity_sensor->register_proximity_handler(
+			[data](sensorfw_proxy::ProximitySample const &sample) {
+				data->queues->proximity.push(sample);
+				wake_main_loop(data);
+			});
+		break;
+	}
+
+	data->registrations[driver_type] = new sensorfw_proxy::HandlerRegistration (std::move (registration));
+
+	registration = data->sensorfw[driver_type]->register_session_handler(
+		[data, driver_type] {
+			invoke_on_main_loop ([data, driver_type] { sensor_session_restored (data, driver_type); });
+		});
+	data->session_registrations[driver_type] = new sensorfw_proxy::HandlerRegistration (std::move (registration));
+
+	register_stream_handler (data, driver_type);
+}
+
+static std::shared_ptr<sensorfw_proxy::SensorfwManager>
+get_sensorfw_manager (SensorData *data)
+{
+	auto manager = data->manager.lock ();
+
+	if (!manager) {
+		manager = std::make_shared<sensorfw_proxy::SensorfwManager>(the_dbus_bus_address());
+		data->manager = manager;
+	}
+
+	return manager;
+}
+
+/* Claims waiting for a backend that could not be brought up are
+ * refused and undone. Streams opened meanwhile were answered already,
+ * they are kept and the next claim tries to bring the backend up again */
+static void
+fail_pending_claims (SensorData *data,
+		     DriverType  driver_type)
+{
+	GPtrArray *pending = data->pending_claims[driver_type];
+
+	data->starting[driver_type] = FALSE;
+
+	while (pending->len > 0) {
+		GDBusMethodInvocation *invocation;
+
+		invocation = (GDBusMethodInvocation *) g_ptr_array_steal_index (pending, 0);
+		client_release (data, g_dbus_method_invocation_get_sender (invocation), driver_type);
+		g_dbus_method_invocation_return_error (invocation,
+						       G_DBUS_ERROR,
+						       G_DBUS_ERROR_FAILED,
+						       "Could not bring up the %s",
+						       driver_type_to_str (driver_type));
+	}
+}
+
+static void
+sensor_brought_up (SensorData *data,
+		   DriverType  driver_type)
+{
+	data->creating[driver_type] = FALSE;
+
+	if (!data->sensorfw[driver_type]) {
+		fail_pending_claims (data, driver_type);
+		return;
+	}
+
+	/* Missing at startup, but sensord came up since */
+	if (!driver_type_exists (data, driver_type)) {
+		set_driver_type_available (data, driver_type);
+		publish_sensor_state (data, driver_type);
+		send_dbus_event (data, mask_for_sensor_type (driver_type));
+	}
+
+	attach_sensor (data, driver_type);
+	update_sensor_settings (data, driver_type);
+
+	if (data->n_claims[driver_type] > 0) {
+		enable_sensorfw_events (data, driver_type);
+	} else {
+		sensor_started_handler (data, driver_type) (true);
+		if (data->lazy)
+			schedule_sensor_tear_down (data, driver_type);
+	}
+}
+
+/* Creating a backend waits for sensord, so it is done on a thread of
+ * its own and the result handed back to the main loop */
+template<typename Sensor, typename Interface>
+static void
+create_sensor_lazily (SensorData                             *data,
+		      DriverType                              driver_type,
+		      std::shared_ptr<Interface> SensorData::*sensor_slot)
+{
+	std::shared_ptr<sensorfw_proxy::SensorfwManager> manager;
+	auto const log = data->log;
+
+	try
+	{
+		manager = get_sensorfw_manager (data);
+	}
+	catch (std::exception const &e)
+	{
+		log->log(log_tag, "Failed to connect to sensorfw: %s", e.what());
+		invoke_on_main_loop ([data, driver_type] { sensor_brought_up (data, driver_type); });
+		return;
+	}
+
+	run_backend_thread (data, [data, driver_type, sensor_slot, log, manager] {
+		std::shared_ptr<Sensor> sensor;
+
+		try
+		{
+			sensor = std::make_shared<Sensor>(log, manager);
+		}
+		catch (std::exception const &e)
+		{
+			log->log(log_tag, "Failed to create %s sensor: %s", driver_type_to_str (driver_type), e.what());
+		}
+
+		invoke_on_main_loop ([data, driver_type, sensor_slot, sensor] {
+			data->*sensor_slot = sensor;
+			data->sensorfw[driver_type] = sensor;
+			sensor_brought_up (data, driver_type);
+		});
+	});
+}
+
+static void
+bring_up_sensor (SensorData *data,
+		 DriverType  driver_type)
+{
+	if (data->creating[driver_type])
+		return;
+
+	g_debug ("Bringing up %s sensor", driver_type_to_str (driver_type));
+	data->creating[driver_type] = TRUE;
+
+	switch (driver_type) {
+	case DRIVER_TYPE_ACCEL:
+		create_sensor_lazily<sensorfw_proxy::SensorfwOrientationSensor> (data, driver_type, &SensorData::orientation_sensor);
+		break;
+	case DRIVER_TYPE_LIGHT:
+		create_sensor_lazily<sensorfw_proxy::SensorfwLightSensor> (data, driver_type, &SensorData::light_sensor);
+		break;
+	case DRIVER_TYPE_COMPASS:
+		create_sensor_lazily<sensorfw_proxy::SensorfwCompassSensor> (data, driver_type, &SensorData::compass_sensor);
+		break;
+	case DRIVER_TYPE_PROXIMITY:
+		create_sensor_lazily<sensorfw_proxy::SensorfwProximitySensor> (data, driver_type, &SensorData::proximity_sensor);
+		break;
+	}
+}
+
+/* Only checks that sensord has the plugins, the sensors themselves are
+ * brought up when claimed */
+static void
+probe_sensors (SensorData                                             *data,
+	       std::shared_ptr<sensorfw_proxy::SensorfwManager> const &manager)
+{
+	static const sensorfw_proxy::Sensorfw::PluginType plugins[NUM_SENSOR_TYPES] = {
+		sensorfw_proxy::Sensorfw::ORIENTATION,
+		sensorfw_proxy::Sensorfw::LIGHT,
+		sensorfw_proxy::Sensorfw::COMPASS,
+		sensorfw_proxy::Sensorfw::PROXIMITY,
+	};
+	std::promise<bool> probed[NUM_SENSOR_TYPES];
+	guint i;
+
+	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
+		sensorfw_proxy::Sensorfw::probe (data->log, manager, plugins[i],
+						 [&probed, i](bool success) { probed[i].set_value (success); });
+	}
+
+	data->accel_avaliable = probed[DRIVER_TYPE_ACCEL].get_future ().get ();
+	data->light_avaliable = probed[DRIVER_TYPE_LIGHT].get_future ().get ();
+	data->compass_avaliable = probed[DRIVER_TYPE_COMPASS].get_future ().get ();
+	data->prox_avaliable = probed[DRIVER_TYPE_PROXIMITY].get_future ().get ();
+}
+
+static void
+sensord_appeared_cb (GDBusConnection *connection,
+		     const gchar     *name,
+		     const gchar     *name_owner,
+		     gpointer         user_data)
+{
+	SensorData *data = (SensorData *) user_data;
+	guint i;
+
+	/* Plugins sensord could not load before might be there now */
+	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
+		if (!driver_type_exists (data, (DriverType) i))
+			bring_up_sensor (data, (DriverType) i);
+	}
+}
+
+/* Constructing a backend waits for sensord to load its plugin, which
+ * may take several attempts, so they are all brought up at once */
+template<typename Sensor>
+static std::future<std::shared_ptr<Sensor>>
+create_sensor_async (std::shared_ptr<sensorfw_proxy::Log> const             &log,
+		     std::shared_ptr<sensorfw_proxy::SensorfwManager> const &manager)
+{
+	return std::async (std::launch::async, [log, manager] {
+		return std::make_shared<Sensor>(log, manager);
+	});
+}
+
 static void
 setup_sensors (SensorData *data)
 {
 	auto const log = std::make_shared<sensorfw_proxy::ConsoleLog>();
+	std::shared_ptr<sensorfw_proxy::SensorfwManager> manager;
 
+	data->log = log;
+
+	/* All the sensors talk to sensord over the same connection */
 	try
 	{
-		data->proximity_sensor = std::make_shared<sensorfw_proxy::SensorfwProximitySensor>(log,
-			the_dbus_bus_address());
+		manager = std::make_shared<sensorfw_proxy::SensorfwManager>(the_dbus_bus_address());
+	}
+	catch (std::exception const &e)
+	{
+		log->log(log_tag, "Failed to connect to sensorfw: %s", e.what());
+		return;
+	}
+
+	data->manager = manager;
+
+	if (data->lazy) {
+		probe_sensors (data, manager);
+		return;
+	}
+
+	auto proximity = create_sensor_async<sensorfw_proxy::SensorfwProximitySensor>(log, manager);
+	auto light = create_sensor_async<sensorfw_proxy::SensorfwLightSensor>(log, manager);
+	auto orientation = create_sensor_async<sensorfw_proxy::SensorfwOrientationSensor>(log, manager);
+	auto compass = create_sensor_async<sensorfw_proxy::SensorfwCompassSensor>(log, manager);
+
+	try
+	{
+		auto const sensor = proximity.get();
+		data->proximity_sensor = sensor;
+		data->sensorfw[DRIVER_TYPE_PROXIMITY] = sensor;
 		data->prox_avaliable = TRUE;
 	}
 	catch (std::exception const &e)
@@ -744,8 +2386,9 @@ setup_sensors (SensorData *data)
 
 	try
 	{
-		data->light_sensor = std::make_shared<sensorfw_proxy::SensorfwLightSensor>(log,
-			the_dbus_bus_address());
+		auto const sensor = light.get();
+		data->light_sensor = sensor;
+		data->sensorfw[DRIVER_TYPE_LIGHT] = sensor;
 		data->light_avaliable = TRUE;
 	}
 	catch (std::exception const &e)
@@ -756,8 +2399,9 @@ setup_sensors (SensorData *data)
 
 	try
 	{
-		data->orientation_sensor = std::make_shared<sensorfw_proxy::SensorfwOrientationSensor>(log,
-			the_dbus_bus_address());
+		auto const sensor = orientation.get();
+		data->orientation_sensor = sensor;
+		data->sensorfw[DRIVER_TYPE_ACCEL] = sensor;
 		data->accel_avaliable = TRUE;
 	}
 	catch (std::exception const &e)
@@ -768,8 +2412,9 @@ setup_sensors (SensorData *data)
 
 	try
 	{
-		data->compass_sensor = std::make_shared<sensorfw_proxy::SensorfwCompassSensor>(log,
-			the_dbus_bus_address());
+		auto const sensor = compass.get();
+		data->compass_sensor = sensor;
+		data->sensorfw[DRIVER_TYPE_COMPASS] = sensor;
 		data->compass_avaliable = TRUE;
 	}
 	catch (std::exception const &e)
@@ -782,108 +2427,84 @@ setup_sensors (SensorData *data)
 int main (int argc, char **argv)
 {
 	SensorData *data;
+	GOptionContext *context;
+	GError *error = NULL;
+	gboolean lazy = FALSE;
+	gint idle_timeout = 30;
+	guint i;
 	int ret = 0;
+	const GOptionEntry options[] = {
+		{ "lazy", 0, 0, G_OPTION_ARG_NONE, &lazy,
+		  "Only bring sensors up while they are claimed", NULL },
+		{ "idle-timeout", 0, 0, G_OPTION_ARG_INT, &idle_timeout,
+		  "Seconds after which unclaimed sensors are torn down in lazy mode (default: 30)", "SECONDS" },
+		{ NULL, 0, 0, G_OPTION_ARG_NONE, NULL, NULL, NULL }
+	};
+
+	context = g_option_context_new (NULL);
+	g_option_context_set_summary (context, "Proxy for sensorfw sensors");
+	g_option_context_add_main_entries (context, options, NULL);
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_printerr ("%s\n", error->message);
+		g_error_free (error);
+		g_option_context_free (context);
+		return 1;
+	}
+	g_option_context_free (context);
 
 	data = g_new0 (SensorData, 1);
 	data->previous_orientation = ORIENTATION_UNDEFINED;
 	data->uses_lux = TRUE;
+	data->wakeup_fd = -1;
+	data->lazy = lazy;
+	data->idle_timeout = MAX (idle_timeout, 0);
+	data->backend_threads = new std::vector<std::thread> ();
+
+	data->clients = create_clients_array ();
+	for (i = 0; i < NUM_SENSOR_TYPES; i++)
+		data->pending_claims[i] = g_ptr_array_new ();
+	data->state = sensor_state_new ();
+
+	if (!setup_sample_queues (data)) {
+		free_sensor_data (data);
+		return 1;
+	}
 
 	/* Set up D-Bus */
 	setup_dbus (data);
 
-	setup_sensors(data);
-	sensorfw_proxy::HandlerRegistration prox_registration;
-	sensorfw_proxy::HandlerRegistration light_registration;
-	sensorfw_proxy::HandlerRegistration orientation_registration;
-	sensorfw_proxy::HandlerRegistration compass_registration;
-
-	if (data->prox_avaliable && data->proximity_sensor) {
-		prox_registration = data->proximity_sensor->register_proximity_handler(
-			[data](sensorfw_proxy::ProximityState state) {
-				data->previous_prox_near = (state == sensorfw_proxy::ProximityState::near);
-				send_dbus_event(data, PROP_PROXIMITY_NEAR);
-			});
-	} else if (data->prox_avaliable) {
-		g_warning("Proximity sensor marked as available but sensor is null");
-		data->prox_avaliable = FALSE;
-	}
+	setup_sensors (data);
+	for (i = 0; i < NUM_SENSOR_TYPES; i++)
+		attach_sensor (data, (DriverType) i);
 
-	if (data->light_avaliable && data->light_sensor) {
-		static double light_accumulator = 0.0f;
-		static double alpha = 0.5f;
+	data->sensord_watch_id = g_bus_watch_name (G_BUS_TYPE_SYSTEM,
+						   SENSORFW_DBUS_NAME,
+						   G_BUS_NAME_WATCHER_FLAGS_NONE,
+						   sensord_appeared_cb,
+						   NULL,
+						   data,
+						   NULL);
 
-		light_registration = data->light_sensor->register_light_handler(
-			[data](double light) {
-				if (data->previous_level != light) {
-                    light_accumulator = (1 - alpha) * light_accumulator + alpha * light;
-                    data->previous_level_accumulator = light_accumulator;
-
-					data->previous_level = light;
-					send_dbus_event(data, PROP_LIGHT_LEVEL);
-				}
-			});
-	} else if (data->light_avaliable) {
-		g_warning("Light sensor marked as available but sensor is null");
-		data->light_avaliable = FALSE;
-	}
-
-	if (data->accel_avaliable && data->orientation_sensor) {
-		orientation_registration = data->orientation_sensor->register_orientation_handler(
-			[data](sensorfw_proxy::OrientationData value) {
-				OrientationUp orientation = data->previous_orientation;
-				switch (value)
-				{
-				case sensorfw_proxy::OrientationData::LeftUp:
-					orientation = ORIENTATION_LEFT_UP;
-					break;
-				case sensorfw_proxy::OrientationData::RightUp:
-					orientation = ORIENTATION_RIGHT_UP;
-					break;
-				case sensorfw_proxy::OrientationData::BottomUp:
-					orientation = ORIENTATION_BOTTOM_UP;
-					break;
-				case sensorfw_proxy::OrientationData::BottomDown:
-					orientation = ORIENTATION_NORMAL;
-					break;
-				case sensorfw_proxy::OrientationData::FaceDown:
-				case sensorfw_proxy::OrientationData::FaceUp:
-					/* Skip FaceDown/FaceUp events */
-					break;
-				default:
-					orientation = ORIENTATION_UNDEFINED;
-					break;
-				}
-				if (data->previous_orientation != orientation) {
-					data->previous_orientation = orientation;
-					send_dbus_event(data, PROP_ACCELEROMETER_ORIENTATION);
-				}
-			});
-	} else if (data->accel_avaliable) {
-		g_warning("Accelerometer marked as available but sensor is null");
-		data->accel_avaliable = FALSE;
-	}
-
-	if (data->compass_avaliable && data->compass_sensor) {
-		compass_registration = data->compass_sensor->register_compass_handler(
-			[data](int heading) {
-				if (data->previous_heading != heading) {
-					data->previous_heading = heading;
-					send_dbus_event(data, PROP_COMPASS_HEADING);
-				}
-			});
-	} else if (data->compass_avaliable) {
-		g_warning("Compass sensor marked as available but sensor is null");
-		data->compass_avaliable = FALSE;
-	}
+	publish_sensor_state (data, DRIVER_TYPE_ACCEL);
+	publish_sensor_state (data, DRIVER_TYPE_LIGHT);
+	publish_sensor_state (data, DRIVER_TYPE_COMPASS);
+	publish_sensor_state (data, DRIVER_TYPE_PROXIMITY);
 
 	data->loop = g_main_loop_new (NULL, TRUE);
 	g_main_loop_run (data->loop);
 	ret = data->ret;
 
-	disable_sensorfw_events (data, DRIVER_TYPE_ACCEL);
-	disable_sensorfw_events (data, DRIVER_TYPE_LIGHT);
-	disable_sensorfw_events (data, DRIVER_TYPE_COMPASS);
-	disable_sensorfw_events (data, DRIVER_TYPE_PROXIMITY);
+	/* Wait for sensord to have stopped the sensors before exiting */
+	for (i = 0; i < NUM_SENSOR_TYPES; i++) {
+		std::promise<void> stopped;
+
+		if (!data->sensorfw[i])
+			continue;
+
+		disable_sensorfw_events (data, (DriverType) i,
+					 [&stopped](bool) { stopped.set_value (); });
+		stopped.get_future ().wait ();
+	}
 
 	free_sensor_data (data);
 
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 FuriLabs
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3 as published by
+ * the Free Software Foundation.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "sensor-state.h"
+
+struct _SensorState {
+	SensorStatePage *page;
+	int fd;
+	int ro_fd;
+};
+
+SensorState *
+sensor_state_new (void)
+{
+	SensorState *state;
+	char path[64];
+
+	state = g_new0 (SensorState, 1);
+	state->fd = -1;
+	state->ro_fd = -1;
+
+	state->fd = memfd_create ("sensor-state", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	if (state->fd < 0) {
+		g_warning ("Could not create sensor state page: %s", g_strerror (errno));
+		goto bail;
+	}
+
+	if (ftruncate (state->fd, sizeof (SensorStatePage)) < 0) {
+		g_warning ("Could not size sensor state page: %s", g_strerror (errno));
+		goto bail;
+	}
+
+	state->page = (SensorStatePage *) mmap (NULL, sizeof (SensorStatePage),
+						PROT_READ | PROT_WRITE, MAP_SHARED,
+						state->fd, 0);
+	if (state->page == MAP_FAILED) {
+		state->page = NULL;
+		g_warning ("Could not map sensor state page: %s", g_strerror (errno));
+		goto bail;
+	}
+
+	state->page->magic = SENSOR_STATE_MAGIC;
+	state->page->version = SENSOR_STATE_VERSION;
+	state->page->size = sizeof (SensorStatePage);
+	state->page->n_slots = SENSOR_STATE_N_SLOTS;
+
+	/* Clients get a read-only file description, so they can neither
+	 * map the page writable nor resize it */
+	g_snprintf (path, sizeof (path), "/proc/self/fd/%d", state->fd);
+	state->ro_fd = open (path, O_RDONLY | O_CLOEXEC);
+	if (state->ro_fd < 0) {
+		g_warning ("Could not reopen sensor state page read-only: %s", g_strerror (errno));
+		goto bail;
+	}
+
+	if (fcntl (state->fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) < 0)
+		g_debug ("Could not seal sensor state page: %s", g_strerror (errno));
+
+	return state;
+
+bail:
+	sensor_state_free (state);
+	return NULL;
+}
+
+void
+sensor_state_free (SensorState *state)
+{
+	if (state == NULL)
+		return;
+
+	if (state->page != NULL)
+		munmap (state->page, sizeof (SensorStatePage));
+	if (state->ro_fd >= 0)
+		close (state->ro_fd);
+	if (state->fd >= 0)
+		close (state->fd);
+	g_free (state);
+}
+
+int
+sensor_state_get_fd (SensorState *state)
+{
+	return state->ro_fd;
+}
+
+void
+sensor_state_update (SensorState *state,
+		     guint        index,
+		     guint32      flags,
+		     guint64      timestamp,
+		     gdouble      value,
+		     gdouble      extra)
+{
+	SensorStateSlot *slot;
+	guint32 seq;
+
+	g_return_if_fail (index < SENSOR_STATE_N_SLOTS);
+
+	/* Each slot only ever has one writer */
+	slot = &state->page->slots[index];
+	seq = slot->sequence;
+
+	__atomic_store_n (&slot->sequence, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence (__ATOMIC_RELEASE);
+
+	slot->flags = flags;
+	slot->timestamp = timestamp;
+	slot->value = value;
+	slot->extra = extra;
+
+	__atomic_store_n (&slot->sequence, seq + 2, __ATOMIC_RELEASE);
+}
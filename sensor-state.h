@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 FuriLabs
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3 as published by
+ * the Free Software Foundation.
+ *
+ */
+
+#pragma once
+
+#include <glib.h>
+
+/*
+ * Layout of the page handed out by net.hadess.SensorProxy.OpenStatePage().
+ *
+ * The page holds one slot per sensor with the latest reading. Slots are
+ * updated under a sequence lock: the sequence number is odd while the
+ * slot is being written, so readers retry until they saw the same even
+ * number before and after copying the slot, see sensor_state_read().
+ */
+
+#define SENSOR_STATE_MAGIC   0x54534e53 /* "SNST" */
+#define SENSOR_STATE_VERSION 1
+
+typedef enum {
+	SENSOR_STATE_SLOT_ACCEL,     /* value: OrientationUp */
+	SENSOR_STATE_SLOT_LIGHT,     /* value: level, extra: smoothed level */
+	SENSOR_STATE_SLOT_COMPASS,   /* value: heading in degrees */
+	SENSOR_STATE_SLOT_PROXIMITY, /* value: 1 if near, 0 if far */
+	SENSOR_STATE_N_SLOTS
+} SensorStateSlotIndex;
+
+enum {
+	SENSOR_STATE_FLAG_AVAILABLE = 1 << 0,
+	SENSOR_STATE_FLAG_LUX       = 1 << 1, /* light level is in lux, not vendor units */
+};
+
+typedef struct {
+	guint32 sequence;
+	guint32 flags;
+	guint64 timestamp; /* sensord timestamp, monotonic microseconds */
+	gdouble value;
+	gdouble extra;
+} __attribute__ ((aligned (64))) SensorStateSlot;
+
+typedef struct {
+	guint32 magic;
+	guint32 version;
+	guint32 size;
+	guint32 n_slots;
+	SensorStateSlot slots[SENSOR_STATE_N_SLOTS] __attribute__ ((aligned (64)));
+} SensorStatePage;
+
+/* Copies a consistent snapshot of a slot, for use by clients */
+static inline void
+sensor_state_read (const SensorStatePage *page,
+		   guint                  index,
+		   SensorStateSlot       *out)
+{
+	const SensorStateSlot *slot = &page->slots[index];
+	guint32 seq;
+
+	do {
+		seq = __atomic_load_n (&slot->sequence, __ATOMIC_ACQUIRE);
+		out->flags = slot->flags;
+		out->timestamp = slot->timestamp;
+		out->value = slot->value;
+		out->extra = slot->extra;
+		__atomic_thread_fence (__ATOMIC_ACQUIRE);
+	} while ((seq & 1) || seq != __atomic_load_n (&slot->sequence, __ATOMIC_RELAXED));
+
+	out->sequence = seq;
+}
+
+typedef struct _SensorState SensorState;
+
+SensorState *sensor_state_new        (void);
+void         sensor_state_free       (SensorState *state);
+int          sensor_state_get_fd     (SensorState *state);
+void         sensor_state_update     (SensorState *state,
+				      guint        index,
+				      guint32      flags,
+				      guint64      timestamp,
+				      gdouble      value,
+				      gdouble      extra);
@@ -18,12 +18,16 @@
 
 #pragma once
 
+#include "completion_handler.h"
 #include "handler_registration.h"
+#include "sensor_sample.h"
 
 namespace sensorfw_proxy
 {
 
-using CompassHandler = std::function<void(double)>;
+using CompassSample = TimedSample<double>;
+using CompassHandler = std::function<void(CompassSample const&)>;
+using CompassBatchHandler = std::function<void(SampleSpan<CompassSample> const&)>;
 
 class CompassSensor
 {
@@ -32,9 +36,11 @@ public:
 
     virtual HandlerRegistration register_compass_handler(
         CompassHandler const& handler) = 0;
+    virtual HandlerRegistration register_compass_batch_handler(
+        CompassBatchHandler const& handler) = 0;
 
-    virtual void enable_compass_events() = 0;
-    virtual void disable_compass_events() = 0;
+    virtual void enable_compass_events(CompletionHandler const& done) = 0;
+    virtual void disable_compass_events(CompletionHandler const& done) = 0;
 
 protected:
     CompassSensor() = default;
@@ -27,8 +27,12 @@ void sensorfw_proxy::ConsoleLog::log(char const* tag, char const* format, ...)
     struct timespec ts;
     clock_gettime(CLOCK_REALTIME, &ts);
 
+    // Sensors log from several threads
+    struct tm local;
+    localtime_r(&ts.tv_sec, &local);
+
     char now[32];
-    auto const offset = strftime(now, sizeof(now), "%F %T", localtime(&ts.tv_sec));
+    auto const offset = strftime(now, sizeof(now), "%F %T", &local);
     snprintf(now + offset, sizeof(now) - offset, ".%06ld", ts.tv_nsec / 1000);
 
     std::string format_str;
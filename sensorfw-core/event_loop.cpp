@@ -18,6 +18,8 @@
 
 #include "event_loop.h"
 
+#include <glib-unix.h>
+
 namespace
 {
 
@@ -62,7 +64,7 @@ struct GSourceFdContext
     {
     }
 
-    static gboolean static_call(int, GIOCondition, GSourceFdContext* ctx)
+    static gboolean static_call(int, GIOCondition condition, GSourceFdContext* ctx)
     {
         try
         {
@@ -71,6 +73,11 @@ struct GSourceFdContext
         catch (...)
         {
         }
+
+        // The peer is gone, keeping the source would make the loop spin
+        if (condition & (G_IO_HUP | G_IO_ERR | G_IO_NVAL))
+            return G_SOURCE_REMOVE;
+
         return G_SOURCE_CONTINUE;
     }
 
@@ -78,6 +85,30 @@ struct GSourceFdContext
     std::function<void()> const callback;
 };
 
+struct GSourceRepeatingContext
+{
+    GSourceRepeatingContext(std::function<void()> const& callback)
+        : callback{callback}
+    {
+    }
+
+    static gboolean static_call(GSourceRepeatingContext* ctx)
+    {
+        try
+        {
+            ctx->callback();
+        }
+        catch (...)
+        {
+        }
+
+        return G_SOURCE_CONTINUE;
+    }
+
+    static void static_destroy(GSourceRepeatingContext* ctx) { delete ctx; }
+    std::function<void()> const callback;
+};
+
 }
 
 sensorfw_proxy::EventLoop::EventLoop(std::string const& name)
@@ -136,3 +167,69 @@ std::future<void> sensorfw_proxy::EventLoop::enqueue(std::function<void()> const
 
     return future;
 }
+
+std::future<void> sensorfw_proxy::EventLoop::enqueue_after(
+    std::chrono::milliseconds delay, std::function<void()> const& callback)
+{
+    auto const gsource = g_timeout_source_new(delay.count());
+    auto const ctx = new GSourceContext{callback};
+    g_source_set_callback(
+            gsource,
+            reinterpret_cast<GSourceFunc>(&GSourceContext::static_call),
+            ctx,
+            reinterpret_cast<GDestroyNotify>(&GSourceContext::static_destroy));
+
+    auto future = ctx->done.get_future();
+
+    g_source_attach(gsource, main_context);
+    g_source_unref(gsource);
+
+    return future;
+}
+
+sensorfw_proxy::EventLoopCancellation sensorfw_proxy::EventLoop::watch_fd(
+    int fd, std::function<void()> const& callback)
+{
+    auto const gsource = g_unix_fd_source_new(
+        fd, GIOCondition(G_IO_IN | G_IO_HUP | G_IO_ERR));
+    auto const ctx = new GSourceFdContext{callback};
+    g_source_set_callback(
+            gsource,
+            reinterpret_cast<GSourceFunc>(&GSourceFdContext::static_call),
+            ctx,
+            reinterpret_cast<GDestroyNotify>(&GSourceFdContext::static_destroy));
+
+    g_source_attach(gsource, main_context);
+
+    return cancellation_for(gsource);
+}
+
+sensorfw_proxy::EventLoopCancellation sensorfw_proxy::EventLoop::schedule_every(
+    std::chrono::milliseconds period, std::function<void()> const& callback)
+{
+    auto const gsource = g_timeout_source_new(period.count());
+    auto const ctx = new GSourceRepeatingContext{callback};
+    g_source_set_callback(
+            gsource,
+            reinterpret_cast<GSourceFunc>(&GSourceRepeatingContext::static_call),
+            ctx,
+            reinterpret_cast<GDestroyNotify>(&GSourceRepeatingContext::static_destroy));
+
+    g_source_attach(gsource, main_context);
+
+    return cancellation_for(gsource);
+}
+
+// Destroy the source from within the loop so that the callback is
+// guaranteed not to be running anymore when the cancellation returns
+sensorfw_proxy::EventLoopCancellation sensorfw_proxy::EventLoop::cancellation_for(GSource* gsource)
+{
+    return [this, gsource]
+        {
+            if (g_main_context_is_owner(main_context))
+                g_source_destroy(gsource);
+            else
+                enqueue([gsource] { g_source_destroy(gsource); }).wait();
+            g_source_unref(gsource);
+        };
+}
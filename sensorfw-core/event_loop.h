@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <thread>
 #include <future>
 
@@ -37,8 +38,15 @@ public:
     void stop();
 
     std::future<void> enqueue(std::function<void()> const& callback);
+    std::future<void> enqueue_after(std::chrono::milliseconds delay,
+                                    std::function<void()> const& callback);
+    EventLoopCancellation watch_fd(int fd, std::function<void()> const& callback);
+    EventLoopCancellation schedule_every(std::chrono::milliseconds period,
+                                         std::function<void()> const& callback);
 
 protected:
+    EventLoopCancellation cancellation_for(GSource* gsource);
+
     std::thread loop_thread;
     GMainContext* main_context;
     GMainLoop* main_loop;
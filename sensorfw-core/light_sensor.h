@@ -18,12 +18,16 @@
 
 #pragma once
 
+#include "completion_handler.h"
 #include "handler_registration.h"
+#include "sensor_sample.h"
 
 namespace sensorfw_proxy
 {
 
-using LightHandler = std::function<void(double)>;
+using LightSample = TimedSample<double>;
+using LightHandler = std::function<void(LightSample const&)>;
+using LightBatchHandler = std::function<void(SampleSpan<LightSample> const&)>;
 
 class LightSensor
 {
@@ -32,9 +36,11 @@ public:
 
     virtual HandlerRegistration register_light_handler(
         LightHandler const& handler) = 0;
+    virtual HandlerRegistration register_light_batch_handler(
+        LightBatchHandler const& handler) = 0;
 
-    virtual void enable_light_events() = 0;
-    virtual void disable_light_events() = 0;
+    virtual void enable_light_events(CompletionHandler const& done) = 0;
+    virtual void disable_light_events(CompletionHandler const& done) = 0;
 
 protected:
     LightSensor() = default;
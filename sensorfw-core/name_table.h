@@ -0,0 +1,125 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace sensorfw_proxy
+{
+
+template<typename T>
+struct NameEntry
+{
+    char const* name;
+    T value;
+};
+
+/**
+ * Maps a fixed set of names to values through a perfect hash, built at
+ * compile time.
+ *
+ * The hash is seeded, and the first seed putting every name into a slot
+ * of its own is picked when the table is built, so a lookup hashes the
+ * name once and compares it against a single candidate. Tables are meant
+ * to be constexpr; if no seed works, building one is not a constant
+ * expression and fails to compile.
+ */
+template<typename T, std::size_t N>
+class NameTable
+{
+public:
+    constexpr NameTable(NameEntry<T> const (&entries)[N])
+    {
+        for (seed = 0; seed < max_seeds; ++seed)
+        {
+            if (fill(entries))
+                return;
+        }
+
+        throw std::logic_error("No perfect hash for the names");
+    }
+
+    /**
+     * @return the value for name, or nullptr if name is not in the table.
+     */
+    T const* find(char const* name) const
+    {
+        if (name == nullptr)
+            return nullptr;
+
+        auto const& slot = slots[hash(seed, name) & (size - 1)];
+        if (slot.name == nullptr || std::strcmp(slot.name, name) != 0)
+            return nullptr;
+
+        return &slot.value;
+    }
+
+private:
+    static constexpr std::size_t slot_count()
+    {
+        std::size_t count = 1;
+        while (count < 2 * N)
+            count *= 2;
+        return count;
+    }
+
+    static std::size_t constexpr size = slot_count();
+    static std::uint32_t constexpr max_seeds = 4096;
+
+    // FNV-1a, with the seed folded into the offset basis and the high bits
+    // folded into the low ones the slot is taken from
+    static constexpr std::uint32_t hash(std::uint32_t seed, char const* name)
+    {
+        std::uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+        for (; *name != '\0'; ++name)
+        {
+            h ^= static_cast<unsigned char>(*name);
+            h *= 16777619u;
+        }
+        return h ^ (h >> 16);
+    }
+
+    constexpr bool fill(NameEntry<T> const (&entries)[N])
+    {
+        for (auto& slot : slots)
+            slot = NameEntry<T>{};
+
+        for (auto const& entry : entries)
+        {
+            auto& slot = slots[hash(seed, entry.name) & (size - 1)];
+            if (slot.name != nullptr)
+                return false;
+            slot = entry;
+        }
+
+        return true;
+    }
+
+    std::uint32_t seed = 0;
+    NameEntry<T> slots[size] = {};
+};
+
+template<typename T, std::size_t N>
+constexpr NameTable<T, N> make_name_table(NameEntry<T> const (&entries)[N])
+{
+    return NameTable<T, N>{entries};
+}
+
+}
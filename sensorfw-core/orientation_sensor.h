@@ -18,7 +18,9 @@
 
 #pragma once
 
+#include "completion_handler.h"
 #include "handler_registration.h"
+#include "sensor_sample.h"
 
 namespace sensorfw_proxy
 {
@@ -34,7 +36,9 @@ enum OrientationData
     FaceUp         /**< Device face is up */
 };
 
-using OrientationHandler = std::function<void(OrientationData)>;
+using OrientationSample = TimedSample<OrientationData>;
+using OrientationHandler = std::function<void(OrientationSample const&)>;
+using OrientationBatchHandler = std::function<void(SampleSpan<OrientationSample> const&)>;
 
 class OrientationSensor
 {
@@ -43,9 +47,11 @@ public:
 
     virtual HandlerRegistration register_orientation_handler(
         OrientationHandler const& handler) = 0;
+    virtual HandlerRegistration register_orientation_batch_handler(
+        OrientationBatchHandler const& handler) = 0;
 
-    virtual void enable_orientation_events() = 0;
-    virtual void disable_orientation_events() = 0;
+    virtual void enable_orientation_events(CompletionHandler const& done) = 0;
+    virtual void disable_orientation_events(CompletionHandler const& done) = 0;
 
 protected:
     OrientationSensor() = default;
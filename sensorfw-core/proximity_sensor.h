@@ -18,13 +18,17 @@
 
 #pragma once
 
+#include "completion_handler.h"
 #include "handler_registration.h"
+#include "sensor_sample.h"
 
 namespace sensorfw_proxy
 {
 
 enum class ProximityState{near, far};
-using ProximityHandler = std::function<void(ProximityState)>;
+using ProximitySample = TimedSample<ProximityState>;
+using ProximityHandler = std::function<void(ProximitySample const&)>;
+using ProximityBatchHandler = std::function<void(SampleSpan<ProximitySample> const&)>;
 
 class ProximitySensor
 {
@@ -33,10 +37,12 @@ public:
 
     virtual HandlerRegistration register_proximity_handler(
         ProximityHandler const& handler) = 0;
+    virtual HandlerRegistration register_proximity_batch_handler(
+        ProximityBatchHandler const& handler) = 0;
     virtual ProximityState proximity_state() = 0;
 
-    virtual void enable_proximity_events() = 0;
-    virtual void disable_proximity_events() = 0;
+    virtual void enable_proximity_events(CompletionHandler const& done) = 0;
+    virtual void disable_proximity_events(CompletionHandler const& done) = 0;
 
 protected:
     ProximitySensor() = default;
@@ -0,0 +1,93 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "qt_sensord_socket.h"
+
+#include <QLocalSocket>
+
+std::unique_ptr<sensorfw_proxy::SensordSocket> sensorfw_proxy::make_sensord_socket()
+{
+    return std::make_unique<QtSensordSocket>();
+}
+
+sensorfw_proxy::QtSensordSocket::QtSensordSocket()
+    : socket{new QLocalSocket}
+{
+}
+
+sensorfw_proxy::QtSensordSocket::~QtSensordSocket()
+{
+    disconnect();
+    delete socket;
+}
+
+bool sensorfw_proxy::QtSensordSocket::connect(std::string const& path)
+{
+    socket->connectToServer(QString::fromStdString(path), QIODevice::ReadWrite);
+    if (socket->state() == QLocalSocket::ConnectingState)
+        socket->waitForConnected();
+
+    return socket->state() == QLocalSocket::ConnectedState;
+}
+
+void sensorfw_proxy::QtSensordSocket::disconnect()
+{
+    socket->disconnectFromServer();
+    if (socket->state() != QLocalSocket::UnconnectedState)
+        socket->waitForDisconnected();
+}
+
+int sensorfw_proxy::QtSensordSocket::descriptor() const
+{
+    return socket->state() == QLocalSocket::ConnectedState ? socket->socketDescriptor() : -1;
+}
+
+bool sensorfw_proxy::QtSensordSocket::write(void const* buffer, int size)
+{
+    if (socket->write(static_cast<char const*>(buffer), size) != size)
+        return false;
+
+    socket->flush();
+    return true;
+}
+
+bool sensorfw_proxy::QtSensordSocket::wait_for_data(int timeout_ms)
+{
+    if (socket->bytesAvailable() > 0)
+        return true;
+
+    return socket->waitForReadyRead(timeout_ms);
+}
+
+int sensorfw_proxy::QtSensordSocket::read(void* buffer, int size)
+{
+    // QLocalSocket only moves data from the kernel into its own buffer
+    // when its event loop runs or when waiting explicitly
+    wait_for_data(0);
+
+    return socket->read(static_cast<char*>(buffer), size);
+}
+
+void sensorfw_proxy::QtSensordSocket::discard()
+{
+    wait_for_data(0);
+    socket->readAll();
+}
+
+std::string sensorfw_proxy::QtSensordSocket::error_string() const
+{
+    return socket->errorString().toStdString();
+}
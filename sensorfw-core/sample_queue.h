@@ -0,0 +1,106 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace sensorfw_proxy
+{
+
+/**
+ * Bounded lock-free queue handing samples from one producer thread to
+ * one consumer thread.
+ *
+ * The producer never waits: once the queue is full the oldest samples
+ * are overwritten, the consumer notices and skips them. Every slot is
+ * guarded by its own sequence number, so the consumer can tell whether
+ * a sample changed while it was being copied.
+ */
+template<typename T, std::size_t N>
+class SampleQueue
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SampleQueue copies samples while they may be overwritten");
+
+public:
+    void push(T const& value)
+    {
+        auto const index = write_index.load(std::memory_order_relaxed);
+        auto& slot = slots[index % N];
+
+        // Odd while the slot is being written
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value = value;
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+
+        write_index.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * Takes the oldest sample that was not overwritten yet.
+     *
+     * @return false if the queue is empty.
+     */
+    bool pop(T& value)
+    {
+        while (true)
+        {
+            auto const written = write_index.load(std::memory_order_acquire);
+            if (read_index == written)
+                return false;
+
+            // Skip what the producer has lapped already
+            if (written - read_index > N)
+                read_index = written - N;
+
+            auto const& slot = slots[read_index % N];
+            auto const expected = 2 * read_index + 2;
+
+            if (slot.sequence.load(std::memory_order_acquire) == expected)
+            {
+                value = slot.value;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == expected)
+                {
+                    ++read_index;
+                    return true;
+                }
+            }
+
+            // Overwritten while we looked at it, start over from the
+            // oldest sample still in the queue
+            read_index = write_index.load(std::memory_order_acquire) - N + 1;
+        }
+    }
+
+private:
+    struct alignas(64) Slot
+    {
+        std::atomic<std::uint64_t> sequence{0};
+        T value;
+    };
+
+    Slot slots[N];
+    alignas(64) std::atomic<std::uint64_t> write_index{0};
+    alignas(64) std::uint64_t read_index = 0;
+};
+
+}
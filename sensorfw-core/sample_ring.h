@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "sensor_sample.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace sensorfw_proxy
+{
+
+/**
+ * What to do when more samples arrive in one go than a ring can hold.
+ */
+enum class OverflowPolicy
+{
+    drop_oldest, /**< keep the newest samples that fit */
+    keep_latest, /**< collapse the batch to the newest sample */
+    decimate     /**< keep every n-th sample, doubling n each time the ring overflows */
+};
+
+/**
+ * Fixed-capacity storage for the samples received in one go.
+ *
+ * Samples are decoded in place into next_slot() and become part of the
+ * ring on commit(). The newest sample is always kept, what happens to
+ * older ones when the ring is full depends on the OverflowPolicy. Nothing
+ * is ever allocated after construction.
+ */
+template<typename T, std::size_t N>
+class SampleRing
+{
+    static_assert(N >= 2, "SampleRing needs room for at least two samples");
+
+public:
+    static std::size_t constexpr capacity = N;
+
+    void clear(OverflowPolicy overflow_policy = OverflowPolicy::drop_oldest)
+    {
+        policy = overflow_policy;
+        head = 0;
+        count = 0;
+        overflowed = false;
+        stride = 1;
+        skipped = 0;
+        uncommitted = false;
+    }
+
+    T* next_slot()
+    {
+        if (policy == OverflowPolicy::decimate)
+            return &samples[count];
+
+        return &samples[(head + count) % N];
+    }
+
+    void commit()
+    {
+        if (policy == OverflowPolicy::decimate)
+            commit_decimated();
+        else if (count < N)
+            ++count;
+        else
+        {
+            overflowed = true;
+            head = (head + 1) % N;
+        }
+    }
+
+    std::size_t size() const { return span_size(); }
+    bool empty() const { return span_size() == 0; }
+
+    T const& latest() const
+    {
+        if (uncommitted)
+            return samples[count];
+
+        return samples[(head + count - 1) % N];
+    }
+
+    /**
+     * Returns the samples oldest first, rotating them in place first if
+     * the ring has wrapped around.
+     */
+    SampleSpan<T> span()
+    {
+        if (policy == OverflowPolicy::keep_latest && overflowed)
+            return {&latest(), 1};
+
+        if (head != 0)
+        {
+            std::rotate(samples, samples + head, samples + N);
+            head = 0;
+        }
+
+        return {samples, span_size()};
+    }
+
+private:
+    // When decimating the ring never wraps, samples that are skipped are
+    // left in the next free slot where the following one overwrites them.
+    // A full ring is only thinned out once a sample arrives that does not
+    // fit, it is decoded into the spare slot past the end meanwhile
+    void commit_decimated()
+    {
+        if (count == N)
+        {
+            for (std::size_t i = 0; i < N / 2; ++i)
+                samples[i] = samples[2 * i + 1];
+            count = N / 2;
+            stride *= 2;
+            samples[count] = samples[N];
+        }
+
+        uncommitted = (++skipped < stride);
+        if (uncommitted)
+            return;
+
+        skipped = 0;
+        ++count;
+    }
+
+    std::size_t span_size() const
+    {
+        if (policy == OverflowPolicy::keep_latest && overflowed)
+            return 1;
+
+        return count + (uncommitted ? 1 : 0);
+    }
+
+    alignas(64) T samples[N + 1];
+    OverflowPolicy policy = OverflowPolicy::drop_oldest;
+    std::size_t head = 0;
+    std::size_t count = 0;
+    bool overflowed = false;
+    std::size_t stride = 1;
+    std::size_t skipped = 0;
+    bool uncommitted = false;
+};
+
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sample_stream.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+std::runtime_error error(char const* what)
+{
+    return std::runtime_error{std::string{what} + ": " + std::strerror(errno)};
+}
+}
+
+sensorfw_proxy::SampleStream::SampleStream(std::size_t capacity)
+    : capacity{capacity},
+      size{sizeof(SampleStreamHeader) + capacity * sizeof(SampleStreamRecord)},
+      header{nullptr},
+      records{nullptr},
+      fd{-1},
+      ro_fd{-1}
+{
+    try
+    {
+        fd = memfd_create("sample-stream", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (fd < 0)
+            throw error("Could not create sample stream");
+
+        if (ftruncate(fd, size) < 0)
+            throw error("Could not size sample stream");
+
+        auto const mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mem == MAP_FAILED)
+            throw error("Could not map sample stream");
+
+        header = static_cast<SampleStreamHeader*>(mem);
+        records = reinterpret_cast<SampleStreamRecord*>(header + 1);
+
+        header->magic = sample_stream_magic;
+        header->version = sample_stream_version;
+        header->record_size = sizeof(SampleStreamRecord);
+        header->capacity = capacity;
+
+        // Readers get their own read-only file description
+        auto const path = "/proc/self/fd/" + std::to_string(fd);
+        ro_fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (ro_fd < 0)
+            throw error("Could not reopen sample stream read-only");
+
+        fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL);
+    }
+    catch (...)
+    {
+        release();
+        throw;
+    }
+}
+
+sensorfw_proxy::SampleStream::~SampleStream()
+{
+    release();
+}
+
+void sensorfw_proxy::SampleStream::release()
+{
+    if (header)
+        munmap(header, size);
+    for (auto const efd : reader_fds)
+        close(efd);
+    reader_fds.clear();
+    if (ro_fd >= 0)
+        close(ro_fd);
+    if (fd >= 0)
+        close(fd);
+}
+
+int sensorfw_proxy::SampleStream::ring_fd() const
+{
+    return ro_fd;
+}
+
+int sensorfw_proxy::SampleStream::add_reader()
+{
+    auto const efd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (efd < 0)
+        throw error("Could not create sample stream eventfd");
+
+    std::lock_guard<std::mutex> lock{readers_mutex};
+    reader_fds.push_back(efd);
+
+    return efd;
+}
+
+void sensorfw_proxy::SampleStream::remove_reader(int event_fd)
+{
+    std::lock_guard<std::mutex> lock{readers_mutex};
+
+    auto const it = std::find(reader_fds.begin(), reader_fds.end(), event_fd);
+    if (it == reader_fds.end())
+        return;
+
+    // Closed under the lock, notify() cannot be writing to it
+    close(*it);
+    reader_fds.erase(it);
+}
+
+void sensorfw_proxy::SampleStream::push(std::uint64_t timestamp, double value)
+{
+    auto const index = header->write_index;
+    auto& record = records[index % capacity];
+
+    // The slot may still be read as record index - capacity, readers have
+    // to see the last bump of write_index before any of the new values
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    record.timestamp = timestamp;
+    record.value = value;
+
+    __atomic_store_n(&header->write_index, index + 1, __ATOMIC_RELEASE);
+}
+
+void sensorfw_proxy::SampleStream::notify()
+{
+    // This only fails if readers let the counter saturate, in which case
+    // they have a pending wakeup anyway
+    std::uint64_t const one = 1;
+    std::lock_guard<std::mutex> lock{readers_mutex};
+
+    for (auto const efd : reader_fds)
+    {
+        auto const ignored = write(efd, &one, sizeof(one));
+        (void) ignored;
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace sensorfw_proxy
+{
+
+std::uint32_t constexpr sample_stream_magic = 0x4d525453; /* "STRM" */
+std::uint32_t constexpr sample_stream_version = 1;
+
+struct SampleStreamRecord
+{
+    std::uint64_t timestamp; /**< monotonic time (microsec) */
+    double value;
+};
+
+/**
+ * Start of the shared memory ring, followed by capacity records.
+ *
+ * write_index counts every record ever written, record n is stored at
+ * n % capacity and write_index is bumped once it is complete. Readers
+ * keep their own read index and may fall behind by less than capacity
+ * records. Record n can be copied once an acquire load of write_index is
+ * above n. After copying it readers have to issue an acquire fence and
+ * check that write_index is still below n + capacity; otherwise the
+ * writer may have been overwriting it and the copy has to be dropped.
+ * The writer fences the bump of write_index off from the stores to the
+ * next record, so a copy holding any part of a newer record always
+ * fails that check.
+ */
+struct alignas(64) SampleStreamHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint32_t capacity;
+    alignas(64) std::uint64_t write_index;
+};
+
+/**
+ * Single producer ring of samples in a memfd, shared read-only with any
+ * number of readers. The writer never waits for readers, if they fall
+ * behind the oldest records are overwritten. Every reader gets an
+ * eventfd of its own, all of them are signalled after each batch.
+ */
+class SampleStream
+{
+public:
+    explicit SampleStream(std::size_t capacity);
+    ~SampleStream();
+
+    // Read-only descriptor of the ring
+    int ring_fd() const;
+
+    // Creates the eventfd a new reader polls on, owned by the stream
+    // until the reader is removed again. Throws if it cannot be created
+    int add_reader();
+    void remove_reader(int event_fd);
+
+    // Called from the thread delivering the samples only
+    void push(std::uint64_t timestamp, double value);
+    void notify();
+
+private:
+    SampleStream(SampleStream const&) = delete;
+    SampleStream& operator=(SampleStream const&) = delete;
+
+    void release();
+
+    std::size_t const capacity;
+    std::size_t const size;
+    SampleStreamHeader* header;
+    SampleStreamRecord* records;
+    int fd;
+    int ro_fd;
+
+    // Only locked by notify() and while readers come and go
+    std::mutex readers_mutex;
+    std::vector<int> reader_fds;
+};
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sensorfw_proxy
+{
+
+template<typename T>
+struct TimedSample
+{
+    std::uint64_t timestamp; /**< monotonic time (microsec) */
+    T value;
+};
+
+/**
+ * Non-owning view of a batch of samples, oldest first. It is only valid
+ * for the duration of the handler call it is passed to.
+ *
+ * Batch handlers get every sample sensord delivered in one go, while the
+ * plain per-value handlers only get the latest sample of each batch.
+ */
+template<typename T>
+class SampleSpan
+{
+public:
+    SampleSpan(T const* data, std::size_t size)
+        : data_{data}, size_{size}
+    {
+    }
+
+    T const* begin() const { return data_; }
+    T const* end() const { return data_ + size_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    T const& operator[](std::size_t i) const { return data_[i]; }
+    T const& latest() const { return data_[size_ - 1]; }
+
+private:
+    T const* data_;
+    std::size_t size_;
+};
+
+}
@@ -0,0 +1,189 @@
+/**
+   @file sensord_data.h
+   @brief Datatypes sent by sensord over the socket data channel
+
+   <p>
+   Copyright (C) 2009-2010 Nokia Corporation
+
+   @author Timo Rongas <ext-timo.2.rongas@nokia.com>
+   @author Antti Virtanen <antti.i.virtanen@nokia.com>
+
+   This file is part of Sensord.
+
+   Sensord is free software; you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License
+   version 2.1 as published by the Free Software Foundation.
+
+   Sensord is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with Sensord.  If not, see <http://www.gnu.org/licenses/>.
+   </p>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+class TimedData
+{
+public:
+
+    /**
+     * Constructor
+     *
+     * @param timestamp monotonic time (microsec)
+     */
+    TimedData(const std::uint64_t& timestamp) : timestamp_(timestamp) {}
+
+    std::uint64_t timestamp_;  /**< monotonic time (microsec) */
+};
+
+class TimedUnsigned : public TimedData {
+public:
+    /**
+     * Default constructor.
+     */
+    TimedUnsigned() : TimedData(0), value_(0) {}
+
+    /**
+     * Constructor.
+     *
+     * @param timestamp timestamp as monotonic time (microsec).
+     * @param value value of the measurement.
+     */
+    TimedUnsigned(const std::uint64_t& timestamp, unsigned value) : TimedData(timestamp), value_(value) {}
+
+    unsigned value_; /**< Measurement value. */
+};
+
+class ProximityData : public TimedUnsigned
+{
+public:
+    /**
+     * Default constructor.
+     */
+    ProximityData() : TimedUnsigned(), withinProximity_(false) {}
+
+    /**
+     * Constructor
+     *
+     * @param timestamp timestamp as monotonic time (microsec).
+     * @param value raw proximity value.
+     * @param withinProximity is there an object within proximity.
+     */
+    ProximityData(const std::uint64_t& timestamp, unsigned int value, bool withinProximity) :
+        TimedUnsigned(timestamp, value), withinProximity_(withinProximity) {}
+
+    bool withinProximity_; /**< is an object within proximity or not */
+};
+
+/**
+ * Datatype for device pose interpretation.
+ */
+class PoseData : public TimedData {
+public:
+    /**
+     * Possible device postures.
+     * @note The interpretation algorithm for orientation currently relies on the
+     *       integer values of the enumeration. Thus changing the names for the
+     *       orientation states is completely ok (for sensord, client apps may
+     *       disagree). Possible new values must be appended to the list and the
+     *       order of values must not be changed!
+     *
+     * Device side naming:
+     * @verbatim
+                          Top
+                      ----------
+                     /  NOKIA  /|
+                    /-------- / |
+                   //       //  /
+                  //       //  /
+          Left   //  Face //  /    Right
+                //       //  /
+               //       //  /
+              /---------/  /
+             /    O    /  /
+            /         /  /
+            ----------  /
+            |_________!/
+              Bottom
+       @endverbatim
+     */
+
+    /**
+     * Device orientation.
+     */
+    enum Orientation
+    {
+        Undefined = 0, /**< Orientation is unknown. */
+        LeftUp,        /**< Device left side is up */
+        RightUp,       /**< Device right side is up */
+        BottomUp,      /**< Device bottom is up */
+        BottomDown,    /**< Device bottom is down */
+        FaceDown,      /**< Device face is down */
+        FaceUp         /**< Device face is up */
+    };
+
+    PoseData::Orientation orientation_; /**< Device Orientation */
+
+    /**
+     * Constructor.
+     */
+    PoseData() : TimedData(0), orientation_(Undefined) {}
+
+    /**
+     * Constructor.
+     * @param orientation Initial value for orientation.
+     */
+    PoseData(Orientation orientation) : TimedData(0), orientation_(orientation) {}
+
+    /**
+     * Constructor
+     * @param timestamp Initial value for timestamp.
+     * @param orientation Initial value for orientation.
+     */
+    PoseData(const std::uint64_t& timestamp, Orientation orientation) : TimedData(timestamp), orientation_(orientation) {}
+};
+
+/**
+ * Datatype for compass measurements.
+ */
+class CompassData : public TimedData
+{
+public:
+    /**
+     * Default constructor.
+     */
+    CompassData() : TimedData(0), degrees_(0), rawDegrees_(0), correctedDegrees_(0), level_(0) {}
+
+    /**
+     * Constructor.
+     *
+     * @param timestamp timestamp as monotonic time (microsec).
+     * @param degrees Angle to north.
+     * @param level Magnetometer calibration level.
+     */
+    CompassData(const std::uint64_t& timestamp, int degrees, int level) :
+        TimedData(timestamp), degrees_(degrees), rawDegrees_(degrees), correctedDegrees_(0), level_(level) {}
+
+    /**
+     * Constructor.
+     *
+     * @param timestamp timestamp as monotonic time (microsec).
+     * @param degrees Angle to north.
+     * @param level Magnetometer calibration level.
+     * @param correctedDegrees Declination corrected angle to north.
+     * @param rawDegrees Not declination corrected angle to north.
+     */
+    CompassData(const std::uint64_t& timestamp, int degrees, int level, int correctedDegrees, int rawDegrees) :
+        TimedData(timestamp), degrees_(degrees), rawDegrees_(rawDegrees), correctedDegrees_(correctedDegrees), level_(level) {}
+
+    int degrees_; /**< Angle to north which may be declination corrected or not. This is the value apps should use */
+    int rawDegrees_; /**< Angle to north without declination correction */
+    int correctedDegrees_; /**< Declination corrected angle to north */
+    int level_;   /**< Magnetometer calibration level. Higher value means better calibration. */
+};
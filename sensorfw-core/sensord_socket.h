@@ -0,0 +1,74 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace sensorfw_proxy
+{
+
+/**
+ * Byte stream connection to the sensord data socket.
+ *
+ * The implementation is picked at build time, see the SENSORFW_USE_QT
+ * option.
+ */
+class SensordSocket
+{
+public:
+    virtual ~SensordSocket() = default;
+
+    virtual bool connect(std::string const& path) = 0;
+    virtual void disconnect() = 0;
+
+    virtual int descriptor() const = 0;
+
+    /**
+     * Blocking write, only used for the session handshake.
+     */
+    virtual bool write(void const* buffer, int size) = 0;
+
+    /**
+     * Wait up to timeout_ms for data to become readable.
+     */
+    virtual bool wait_for_data(int timeout_ms) = 0;
+
+    /**
+     * Non-blocking read of whatever is queued, up to size bytes.
+     *
+     * @return number of bytes read, 0 if there is nothing to read right
+     *         now or -1 on error or end of stream.
+     */
+    virtual int read(void* buffer, int size) = 0;
+
+    /**
+     * Throw away everything that can be read right now.
+     */
+    virtual void discard() = 0;
+
+    virtual std::string error_string() const = 0;
+
+protected:
+    SensordSocket() = default;
+    SensordSocket(SensordSocket const&) = delete;
+    SensordSocket& operator=(SensordSocket const&) = delete;
+};
+
+std::unique_ptr<SensordSocket> make_sensord_socket();
+
+}
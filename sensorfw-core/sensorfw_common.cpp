@@ -17,8 +17,12 @@
  */
 
 #include "sensorfw_common.h"
+#include "event_loop_handler_registration.h"
+#include "scoped_g_error.h"
 #include "socketreader.h"
 
+#include <algorithm>
+
 namespace
 {
 char const* const log_tag = "Sensorfw";
@@ -27,42 +31,301 @@ auto const null_handler = [](double){};
 char const* const dbus_sensorfw_name = "com.nokia.SensorService";
 char const* const dbus_sensorfw_path = "/SensorManager";
 char const* const dbus_sensorfw_interface = "local.SensorManager";
+
+// How long to wait for sensord when bringing a sensor up
+auto constexpr service_timeout = std::chrono::seconds(5);
+
+// A stream is considered stalled after this many expected frames did not
+// show up, but never before min_stall_timeout. Sensors left at sensord's
+// default rate are assumed to report every default_interval
+int constexpr stall_intervals = 10;
+auto constexpr min_stall_timeout = std::chrono::milliseconds(2000);
+auto constexpr default_interval = std::chrono::milliseconds(200);
+
+// Waiters may start or stop the sensor again, so the list is taken over
+// before calling them
+void complete(std::vector<sensorfw_proxy::CompletionHandler>& waiters, bool success)
+{
+    auto const to_complete = std::move(waiters);
+    waiters.clear();
+
+    for (auto const& done : to_complete)
+        done(success);
+}
+
+void sensord_reply_ready(GObject* source, GAsyncResult* res, gpointer user_data)
+{
+    using ReplyHandler = std::function<void(GVariant*)>;
+    std::unique_ptr<ReplyHandler> const handler{static_cast<ReplyHandler*>(user_data)};
+    sensorfw_proxy::ScopedGError error;
+
+    auto const result = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), res, error);
+    (*handler)(result);
+
+    if (result)
+        g_variant_unref(result);
+}
 }
 
 sensorfw_proxy::Sensorfw::Sensorfw(
     std::shared_ptr<Log> const& log,
-    std::string const& dbus_bus_address,
-    std::string const& name,
+    std::shared_ptr<SensorfwManager> const& manager,
     PluginType const& plugin)
     : log{log},
-      dbus_connection{dbus_bus_address},
-      dbus_event_loop{name},
-      m_socket(std::make_shared<SocketReader>()),
+      manager{manager},
+      dbus_connection{manager->connection()},
+      dbus_event_loop{manager->dbus_loop()},
+      m_socket(std::make_shared<SocketReader>(log)),
+      reader_loop{manager->reader_loop()},
       m_plugin(plugin),
-      m_pid(getpid())
+      m_pid(getpid()),
+      m_plugin_path{std::string{dbus_sensorfw_path} + "/" + plugin_string(plugin)}
 {
-    if (!load_plugin())
+    // The plugin is loaded and the sensor requested by a chain of
+    // asynchronous calls, so several sensors can be brought up at once
+    std::promise<bool> loaded;
+    std::promise<bool> requested;
+    dbus_event_loop.enqueue(
+        [this, &loaded, &requested]
+        {
+            load_plugin(this->log, *this->manager, m_plugin,
+                [this, &loaded, &requested] (bool success)
+                {
+                    loaded.set_value(success);
+                    if (success)
+                        request_sensor([&requested] (bool success) { requested.set_value(success); });
+                });
+        });
+
+    if (!loaded.get_future().get())
         throw std::runtime_error("Could not create sensorfw backend");
 
-    request_sensor();
+    if (!requested.get_future().get())
+        throw std::runtime_error("Could not request sensorfw sensor");
 
     log->log(log_tag, "Got plugin_string %s", plugin_string());
     log->log(log_tag, "Got plugin_interface %s", plugin_interface());
     log->log(log_tag, "Got plugin_path %s", plugin_path());
 
     m_socket->initiateConnection(m_sessionid);
+
+    // From here on a sensord restart is recovered from
+    dbus_event_loop.enqueue(
+        [this]
+        {
+            service_registration = this->manager->register_service_handler(
+                [this] (bool owned)
+                {
+                    if (owned)
+                        recover_session();
+                    else
+                        session_lost();
+                });
+        }).wait();
 }
 
 sensorfw_proxy::Sensorfw::~Sensorfw()
 {
-    stop();
-    release_sensor();
+    service_registration = HandlerRegistration{};
+
+    // Also waits for calls still in flight, their replies refer to this
+    std::promise<void> released;
+    dbus_event_loop.enqueue(
+        [this, &released]
+        {
+            m_closing = true;
+            stop(
+                [this, &released] (bool)
+                {
+                    release_sensor(m_sessionid,
+                        [this, &released] (bool)
+                        {
+                            wait_for_settings([&released] (bool) { released.set_value(); });
+                        });
+                });
+        });
+    released.get_future().wait();
+
+    // The reader may have reported a lost connection, or finished a
+    // reconnection, before it was stopped
+    reader_loop.enqueue([]{}).wait();
+    dbus_event_loop.enqueue([]{}).wait();
+
     m_socket->dropConnection();
 }
 
+sensorfw_proxy::HandlerRegistration sensorfw_proxy::Sensorfw::register_session_handler(
+    SessionHandler const& handler)
+{
+    return EventLoopHandlerRegistration{
+        dbus_event_loop,
+        [this, &handler]{ this->m_session_handler = handler; },
+        [this]{ this->m_session_handler = nullptr; }};
+}
+
+unsigned sensorfw_proxy::Sensorfw::stall_count() const
+{
+    return m_stall_count;
+}
+
+void sensorfw_proxy::Sensorfw::set_overflow_policy(OverflowPolicy policy)
+{
+    overflow_policy = policy;
+}
+
+void sensorfw_proxy::Sensorfw::set_interval(int interval_ms)
+{
+    dbus_event_loop.enqueue(
+        [this, interval_ms]
+        {
+            m_wanted_interval = interval_ms;
+            apply_interval();
+        });
+}
+
+void sensorfw_proxy::Sensorfw::set_buffering(unsigned buffer_size, unsigned interval_ms)
+{
+    buffer_size = std::min(buffer_size, frame_capacity);
+
+    dbus_event_loop.enqueue(
+        [this, buffer_size, interval_ms]
+        {
+            m_wanted_buffer_size = buffer_size;
+            m_wanted_buffer_interval = interval_ms;
+            apply_buffering();
+        });
+}
+
+void sensorfw_proxy::Sensorfw::apply_interval()
+{
+    // Applied to the new session once it is recovered, and after the call
+    // in flight for an earlier request
+    if (m_closing || m_session_lost || m_interval_pending || m_wanted_interval == m_interval)
+        return;
+
+    auto const interval_ms = m_wanted_interval;
+    m_interval_pending = true;
+
+    call_sensord(
+        dbus_connection,
+        plugin_path(),
+        plugin_interface(),
+        "setInterval",
+        g_variant_new("(ii)", m_sessionid, interval_ms),
+        NULL,
+        [this, interval_ms, session = m_session] (GVariant* result)
+        {
+            auto const current = (session == m_session);
+            m_interval_pending = false;
+
+            if (current && result)
+            {
+                m_interval = interval_ms;
+                log->log(log_tag, "Set interval of %s to %d ms", plugin_string(), interval_ms);
+                arm_watchdog();
+            }
+            else if (current)
+            {
+                log->log(log_tag, "failed to set interval of %s to %d ms", plugin_string(), interval_ms);
+            }
+
+            // A failed request is not retried until a different one comes in
+            if (!current || result || m_wanted_interval != interval_ms)
+                apply_interval();
+            settings_call_done();
+        });
+}
+
+void sensorfw_proxy::Sensorfw::wait_for_settings(CompletionHandler const& done)
+{
+    if (m_interval_pending || m_buffering_pending)
+        m_settings_waiters.push_back(done);
+    else
+        done(true);
+}
+
+void sensorfw_proxy::Sensorfw::settings_call_done()
+{
+    if (!m_interval_pending && !m_buffering_pending)
+        complete(m_settings_waiters, true);
+}
+
+void sensorfw_proxy::Sensorfw::apply_buffering()
+{
+    auto const buffer_size = m_wanted_buffer_size;
+    auto const interval_ms = m_wanted_buffer_interval;
+
+    // Applied to the new session once it is recovered, and after the calls
+    // in flight for an earlier request
+    if (m_closing || m_session_lost || m_buffering_pending ||
+        (buffer_size == m_buffer_size && interval_ms == m_buffer_interval))
+        return;
+
+    m_buffering_pending = true;
+
+    auto const applied =
+        [this, buffer_size, interval_ms, session = m_session] (bool success)
+        {
+            auto const current = (session == m_session);
+            m_buffering_pending = false;
+
+            if (current && success)
+            {
+                m_buffer_size = buffer_size;
+                m_buffer_interval = interval_ms;
+                log->log(log_tag, "Set buffering of %s to %u samples, %u ms",
+                         plugin_string(), buffer_size, interval_ms);
+                arm_watchdog();
+            }
+
+            // A failed request is not retried until a different one comes in
+            if (!current || success ||
+                m_wanted_buffer_size != buffer_size || m_wanted_buffer_interval != interval_ms)
+                apply_buffering();
+            settings_call_done();
+        };
+
+    // The interval has to be in place before a size that enables buffering
+    set_session_value("setBufferInterval", interval_ms,
+        [this, buffer_size, applied, session = m_session] (bool success)
+        {
+            if (!success || session != m_session)
+            {
+                applied(false);
+                return;
+            }
+
+            set_session_value("setBufferSize", buffer_size, applied);
+        });
+}
+
+void sensorfw_proxy::Sensorfw::set_session_value(
+    char const* method, unsigned value, CompletionHandler const& done)
+{
+    call_sensord(
+        dbus_connection,
+        plugin_path(),
+        plugin_interface(),
+        method,
+        g_variant_new("(iu)", m_sessionid, value),
+        NULL,
+        [this, method, done] (GVariant* result)
+        {
+            if (!result)
+                log->log(log_tag, "failed to call %s on %s", method, plugin_string());
+
+            done(result != nullptr);
+        });
+}
+
 const char* sensorfw_proxy::Sensorfw::plugin_string() const
 {
-    switch (m_plugin) {
+    return plugin_string(m_plugin);
+}
+
+const char* sensorfw_proxy::Sensorfw::plugin_string(PluginType plugin)
+{
+    switch (plugin) {
         case PluginType::LIGHT: return "alssensor";
         case PluginType::PROXIMITY: return "proximitysensor";
         case PluginType::ORIENTATION: return "orientationsensor";
@@ -72,6 +335,12 @@ const char* sensorfw_proxy::Sensorfw::plugin_string() const
     return "";
 }
 
+bool sensorfw_proxy::Sensorfw::reports_continuously(PluginType plugin)
+{
+    // The others only report changes, a quiet stream is no sign of a stall
+    return plugin == PluginType::COMPASS;
+}
+
 const char* sensorfw_proxy::Sensorfw::plugin_interface() const
 {
     switch (m_plugin) {
@@ -86,193 +355,466 @@ const char* sensorfw_proxy::Sensorfw::plugin_interface() const
 
 const char* sensorfw_proxy::Sensorfw::plugin_path() const
 {
-    char *new_str;
-    if (asprintf(&new_str,"%s/%s", dbus_sensorfw_path, plugin_string()) == -1)
-        return "";
+    return m_plugin_path.c_str();
+}
 
-    return new_str;
+void sensorfw_proxy::Sensorfw::probe(
+    std::shared_ptr<Log> const& log,
+    std::shared_ptr<SensorfwManager> const& manager,
+    PluginType plugin,
+    CompletionHandler const& done)
+{
+    auto const manager_ptr = manager.get();
+
+    manager->dbus_loop().enqueue(
+        [log, manager_ptr, plugin, done]
+        {
+            load_plugin(log, *manager_ptr, plugin, done);
+        });
 }
 
-bool sensorfw_proxy::Sensorfw::load_plugin()
+// The manager is only referred to by pointer here, its owner keeps it
+// alive until done is called
+void sensorfw_proxy::Sensorfw::load_plugin(
+    std::shared_ptr<Log> const& log,
+    SensorfwManager& manager,
+    PluginType plugin,
+    CompletionHandler const& done)
 {
-    int constexpr timeout_default = 100;
-    int constexpr max_attempts = 5;
-    GVariant* result = nullptr;
-    gboolean the_result = false;
-    int attempt = 0;
+    auto const name = plugin_string(plugin);
+    auto const manager_ptr = &manager;
+
+    // If sensord is not up yet the plugin is loaded as soon as it shows
+    // up, later appearances are up to the owner of the sensors
+    manager.wait_for_service(
+        service_timeout,
+        [log, manager_ptr, name, done] (bool owned)
+        {
+            if (!owned)
+            {
+                log->log(log_tag, "D-Bus Sensorfw not available (Name: %s), not loading plugin: %s",
+                         dbus_sensorfw_name, name);
+                done(false);
+                return;
+            }
 
-    while (attempt < max_attempts)
-    {
-        result = g_dbus_connection_call_sync(
-                dbus_connection,
-                dbus_sensorfw_name,
+            call_sensord(
+                manager_ptr->connection(),
                 dbus_sensorfw_path,
                 dbus_sensorfw_interface,
                 "loadPlugin",
-                g_variant_new("(s)", plugin_string()),
+                g_variant_new("(s)", name),
                 G_VARIANT_TYPE("(b)"),
-                G_DBUS_CALL_FLAGS_NONE,
-                timeout_default,
-                NULL,
-                NULL);
-
-        attempt++;
+                [log, name, done] (GVariant* result)
+                {
+                    gboolean the_result = false;
 
-        if (result)
-        {
-            g_variant_get(result, "(b)", &the_result);
-            g_variant_unref(result);
-
-            if (the_result)
-            {
-                std::string message = "Attempt " + std::to_string(attempt) + ": Success, loaded plugin: " + plugin_string();
-                log->log(log_tag, "%s", message.c_str());
-                return true;
-            }
-            else
-            {
-                std::string message = "Attempt " + std::to_string(attempt) + ": Failed to load plugin: " + plugin_string();
-                log->log(log_tag, "%s", message.c_str());
-            }
-        }
-        else
-        {
-            // in case sensorfwd bus is not even up we'll end up here
-            std::string message = "Attempt " + std::to_string(attempt) + ": Failed, D-Bus Sensorfw not available (Name: " + dbus_sensorfw_name + ", Path: " + dbus_sensorfw_path + ")";
-            log->log(log_tag, "%s", message.c_str());
-        }
+                    if (result)
+                        g_variant_get(result, "(b)", &the_result);
 
-        std::this_thread::sleep_for(std::chrono::seconds(1));
-    }
+                    if (the_result)
+                        log->log(log_tag, "Success, loaded plugin: %s", name);
+                    else
+                        log->log(log_tag, "Failed to load plugin: %s", name);
 
-    log->log(log_tag, "All attempts failed to load plugin");
-    return false;
+                    done(the_result);
+                });
+        });
 }
 
-void sensorfw_proxy::Sensorfw::request_sensor()
+void sensorfw_proxy::Sensorfw::call_sensord(
+    GDBusConnection* connection,
+    char const* path,
+    char const* interface,
+    char const* method,
+    GVariant* parameters,
+    GVariantType const* reply_type,
+    ReplyHandler const& handler)
 {
+    // The reply is dispatched on the thread-default context, which is
+    // that of dbus_event_loop
     int constexpr timeout_default = 100;
-    auto const result =  g_dbus_connection_call_sync(
-            dbus_connection,
+    g_dbus_connection_call(
+            connection,
             dbus_sensorfw_name,
-            dbus_sensorfw_path,
-            dbus_sensorfw_interface,
-            "requestSensor",
-            g_variant_new("(sx)", plugin_string(), m_pid),
-            G_VARIANT_TYPE("(i)"),
+            path,
+            interface,
+            method,
+            parameters,
+            reply_type,
             G_DBUS_CALL_FLAGS_NONE,
             timeout_default,
             NULL,
-            NULL);
+            sensord_reply_ready,
+            new ReplyHandler{handler});
+}
+
+void sensorfw_proxy::Sensorfw::request_sensor(CompletionHandler const& done)
+{
+    call_sensord(
+        dbus_connection,
+        dbus_sensorfw_path,
+        dbus_sensorfw_interface,
+        "requestSensor",
+        g_variant_new("(sx)", plugin_string(), m_pid),
+        G_VARIANT_TYPE("(i)"),
+        [this, done] (GVariant* result)
+        {
+            if (!result)
+            {
+                log->log(log_tag, "failed to call request_sensor");
+                done(false);
+                return;
+            }
 
-    if (!result)
+            gint32 the_result;
+            g_variant_get(result, "(i)", &the_result);
+            m_sessionid = the_result;
+
+            log->log(log_tag, "Got new plugin for %s with pid %i and session %i", plugin_string(), m_pid, m_sessionid);
+            done(true);
+        });
+}
+
+void sensorfw_proxy::Sensorfw::release_sensor(int sessionid, CompletionHandler const& done)
+{
+    if (sessionid < 0)
     {
-        log->log(log_tag, "failed to call request_sensor");
+        done(false);
         return;
     }
 
-    gint32 the_result;
-    g_variant_get(result, "(i)", &the_result);
-    g_variant_unref(result);
-
-    m_sessionid = the_result;
+    call_sensord(
+        dbus_connection,
+        dbus_sensorfw_path,
+        dbus_sensorfw_interface,
+        "releaseSensor",
+        g_variant_new("(six)", plugin_string(), sessionid, m_pid),
+        G_VARIANT_TYPE("(b)"),
+        [this, done] (GVariant* result)
+        {
+            if (!result)
+            {
+                log->log(log_tag, "failed to release SensorfwSensor");
+                done(false);
+                return;
+            }
 
-    log->log(log_tag, "Got new plugin for %s with pid %i and session %i", plugin_string(), m_pid, m_sessionid);
+            gboolean the_result;
+            g_variant_get(result, "(b)", &the_result);
+            done(the_result);
+        });
 }
 
-bool sensorfw_proxy::Sensorfw::release_sensor()
+void sensorfw_proxy::Sensorfw::start(CompletionHandler const& done)
 {
-    int constexpr timeout_default = 100;
-    auto const result =  g_dbus_connection_call_sync(
-            dbus_connection,
-            dbus_sensorfw_name,
-            dbus_sensorfw_path,
-            dbus_sensorfw_interface,
-            "releaseSensor",
-            g_variant_new("(six)", plugin_string(), m_sessionid, m_pid),
-            G_VARIANT_TYPE("(b)"),
-            G_DBUS_CALL_FLAGS_NONE,
-            timeout_default,
-            NULL,
-            NULL);
+    m_wants_running = true;
+    if (done)
+        m_start_waiters.push_back(done);
 
-    if (!result)
-    {
-        log->log(log_tag, "failed to release SensorfwSensor");
-        return false;
-    }
+    update_running();
+}
 
-    gboolean the_result;
-    g_variant_get(result, "(b)", &the_result);
-    g_variant_unref(result);
+void sensorfw_proxy::Sensorfw::stop(CompletionHandler const& done)
+{
+    m_wants_running = false;
+    if (done)
+        m_stop_waiters.push_back(done);
 
-    return the_result;
+    update_running();
 }
 
-void sensorfw_proxy::Sensorfw::start()
+// Brings sensord in line with m_wants_running, one call at a time. The
+// state may change again while a call is in flight, which is picked up
+// once it completes
+void sensorfw_proxy::Sensorfw::update_running()
 {
-    if (m_running)
+    if (m_call_pending || m_recovering)
         return;
 
-    m_running = true;
-    read_loop = std::thread([this](){
-        log->log(log_tag, "Eventloop started");
-        while (m_running) {
-            if (m_socket->socket()->waitForReadyRead(10))
-                data_recived_impl();
+    if (m_session_lost)
+    {
+        // What was asked for is picked up again once the session is back
+        complete(m_start_waiters, false);
+        complete(m_stop_waiters, true);
+        return;
+    }
+
+    if (m_wants_running && !m_running)
+    {
+        auto const fd = m_socket->descriptor();
+        if (fd < 0)
+        {
+            log->log(log_tag, "No data socket for %s, not starting", plugin_string());
+            m_wants_running = false;
+            complete(m_start_waiters, false);
+            return;
         }
-        m_running = false;
-        log->log(log_tag, "Eventloop stopped");
-    });
 
-    int constexpr timeout_default = 100;
-    auto const result =  g_dbus_connection_call_sync(
+        m_call_pending = true;
+        read_watch = reader_loop.watch_fd(fd, [this] { data_ready(); });
+
+        call_sensord(
             dbus_connection,
-            dbus_sensorfw_name,
             plugin_path(),
             plugin_interface(),
             "start",
             g_variant_new("(i)", m_sessionid),
             NULL,
-            G_DBUS_CALL_FLAGS_NONE,
-            timeout_default,
+            [this, session = m_session] (GVariant* result)
+            {
+                m_call_pending = false;
+
+                if (session != m_session)
+                {
+                    update_running();
+                    return;
+                }
+
+                if (result)
+                {
+                    m_running = true;
+                    m_last_data = std::chrono::steady_clock::now().time_since_epoch();
+                    arm_watchdog();
+                }
+                else
+                {
+                    log->log(log_tag, "failed to start SensorfwSensor");
+                    stop_reading();
+                    // Do not retry until asked to again
+                    m_wants_running = false;
+                }
+
+                complete(m_start_waiters, m_running);
+                update_running();
+            });
+    }
+    else if (!m_wants_running && m_running)
+    {
+        m_call_pending = true;
+
+        call_sensord(
+            dbus_connection,
+            plugin_path(),
+            plugin_interface(),
+            "stop",
+            g_variant_new("(i)", m_sessionid),
             NULL,
-            NULL);
+            [this, session = m_session] (GVariant* result)
+            {
+                m_call_pending = false;
+
+                if (session != m_session)
+                {
+                    update_running();
+                    return;
+                }
+
+                if (!result)
+                    log->log(log_tag, "failed to stop SensorfwSensor");
 
-    if (!result)
+                m_running = false;
+                stop_reading();
+
+                complete(m_stop_waiters, result != nullptr);
+                update_running();
+            });
+    }
+    else
     {
-        log->log(log_tag, "failed to start SensorfwSensor");
-        return;
+        // Nothing to do, anyone who asked for the other state was overruled
+        complete(m_start_waiters, m_running);
+        complete(m_stop_waiters, !m_running);
+    }
+}
+
+void sensorfw_proxy::Sensorfw::data_ready()
+{
+    // One read per wakeup normally gets everything sensord sent; only when
+    // the receive buffer fills up there may be more to pick up right away
+    m_last_data.store(std::chrono::steady_clock::now().time_since_epoch(),
+                      std::memory_order_relaxed);
+
+    bool more;
+    do
+    {
+        more = m_socket->receive();
+        data_recived_impl();
+    }
+    while (more);
+
+    if (m_socket->connectionLost())
+        dbus_event_loop.enqueue([this] { session_lost(); });
+}
+
+void sensorfw_proxy::Sensorfw::stop_reading()
+{
+    if (stream_watchdog)
+    {
+        stream_watchdog();
+        stream_watchdog = nullptr;
+    }
+
+    if (read_watch)
+    {
+        read_watch();
+        read_watch = nullptr;
     }
-    g_variant_unref(result);
 }
 
-void sensorfw_proxy::Sensorfw::stop()
+void sensorfw_proxy::Sensorfw::session_lost()
 {
-    if (!m_running)
+    if (m_closing || m_session_lost)
         return;
 
+    log->log(log_tag, "Lost sensord session %i of %s", m_sessionid, plugin_string());
+
+    // Replies to calls still in flight are about the old session
+    ++m_session;
+    m_session_lost = true;
+    m_sessionid = -1;
     m_running = false;
+    stop_reading();
+    m_socket->dropConnection();
 
-    int constexpr timeout_default = 100;
-    auto const result =  g_dbus_connection_call_sync(
-            dbus_connection,
-            dbus_sensorfw_name,
-            plugin_path(),
-            plugin_interface(),
-            "stop",
-            g_variant_new("(i)", m_sessionid),
-            NULL,
-            G_DBUS_CALL_FLAGS_NONE,
-            timeout_default,
-            NULL,
-            NULL);
+    // sensord may only have dropped the connection, or be about to come
+    // back; otherwise this is retried when it appears on the bus
+    recover_session();
+}
 
-    if (!result)
-        log->log(log_tag, "failed to stop SensorfwSensor");
-    else
-        g_variant_unref(result);
+void sensorfw_proxy::Sensorfw::recover_session()
+{
+    if (m_closing || !m_session_lost || m_recovering)
+        return;
+
+    m_recovering = true;
+    load_plugin(log, *manager, m_plugin,
+        [this] (bool success)
+        {
+            if (!success)
+            {
+                session_recovered(false);
+                return;
+            }
+
+            request_sensor(
+                [this] (bool success)
+                {
+                    if (!success)
+                    {
+                        session_recovered(false);
+                        return;
+                    }
+
+                    // Connecting waits for sensord to answer on the socket,
+                    // which must not hold up the calls of the other sensors
+                    reader_loop.enqueue(
+                        [this, sessionid = m_sessionid]
+                        {
+                            auto const connected = m_socket->initiateConnection(sessionid);
+                            dbus_event_loop.enqueue([this, connected] { session_recovered(connected); });
+                        });
+                });
+        });
+}
+
+void sensorfw_proxy::Sensorfw::session_recovered(bool success)
+{
+    m_recovering = false;
+
+    if (!success)
+    {
+        log->log(log_tag, "Could not recover session of %s, waiting for sensord", plugin_string());
+        update_running();
+        return;
+    }
+
+    log->log(log_tag, "Recovered session of %s as %i", plugin_string(), m_sessionid);
+    m_session_lost = false;
+    m_stalls_in_row = 0;
+
+    // The new session starts out with sensord's defaults, what was asked
+    // for meanwhile is applied too
+    m_interval = 0;
+    m_buffer_size = 0;
+    m_buffer_interval = 0;
+    apply_interval();
+    apply_buffering();
+
+    update_running();
+
+    if (m_session_handler)
+        m_session_handler();
+}
+
+void sensorfw_proxy::Sensorfw::arm_watchdog()
+{
+    if (stream_watchdog)
+    {
+        stream_watchdog();
+        stream_watchdog = nullptr;
+    }
+
+    if (!m_running || !reports_continuously(m_plugin))
+        return;
+
+    stream_watchdog = dbus_event_loop.schedule_every(stall_timeout(), [this] { check_stream(); });
+}
+
+void sensorfw_proxy::Sensorfw::check_stream()
+{
+    if (!m_running || m_call_pending)
+        return;
+
+    auto const silence = std::chrono::steady_clock::now().time_since_epoch() - m_last_data.load();
+    if (silence < stall_timeout())
+    {
+        m_stalls_in_row = 0;
+        return;
+    }
+
+    ++m_stall_count;
+    auto const silence_ms = std::chrono::duration_cast<std::chrono::milliseconds>(silence).count();
+
+    if (m_stalls_in_row++ == 0)
+    {
+        log->log(log_tag, "No data from %s for %lld ms, restarting it",
+                 plugin_string(), static_cast<long long>(silence_ms));
+        // Started again once the stop went through
+        stop(nullptr);
+        start(nullptr);
+        return;
+    }
+
+    log->log(log_tag, "No data from %s for %lld ms after restarting it, requesting a new session",
+             plugin_string(), static_cast<long long>(silence_ms));
+    renew_session();
+}
+
+void sensorfw_proxy::Sensorfw::renew_session()
+{
+    auto const sessionid = m_sessionid;
+
+    session_lost();
+
+    // sensord handles this before the new session is requested
+    release_sensor(sessionid, [] (bool) {});
+}
+
+// Frames are expected every interval, unless sensord was asked to buffer
+// samples, then they may be held back for the buffer interval or until
+// the buffer is full
+std::chrono::milliseconds sensorfw_proxy::Sensorfw::stall_timeout() const
+{
+    auto frame_interval = m_interval > 0 ? std::chrono::milliseconds(m_interval) : default_interval;
+
+    if (m_buffer_size > 1)
+    {
+        if (m_buffer_interval > 0)
+            frame_interval = std::max(frame_interval, std::chrono::milliseconds(m_buffer_interval));
+        else
+            frame_interval *= m_buffer_size;
+    }
 
-    read_loop.join();
-    read_loop = std::thread();
+    return std::max(frame_interval * stall_intervals, min_stall_timeout);
 }
@@ -18,10 +18,17 @@
 
 #pragma once
 
-#include "dbus_connection_handle.h"
-#include "dbus_event_loop.h"
+#include "completion_handler.h"
+#include "sensorfw_manager.h"
 
 #include "log.h"
+#include "sample_ring.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
 
 class SocketReader;
 namespace sensorfw_proxy {
@@ -37,36 +44,147 @@ public:
 
     Sensorfw(
         std::shared_ptr<Log> const& log,
-        std::string const& dbus_bus_address,
-        std::string const& name,
+        std::shared_ptr<SensorfwManager> const& manager,
         PluginType const& plugin);
     virtual ~Sensorfw();
 
+    void set_overflow_policy(OverflowPolicy policy);
+
+    // Asks sensord to sample at most every interval_ms, 0 restores the
+    // plugin's default rate
+    void set_interval(int interval_ms);
+
+    // Lets sensord hold back up to buffer_size samples, or interval_ms
+    // worth of them, and deliver them in one frame. The size is capped to
+    // what one frame is decoded into, 0 turns buffering off again
+    void set_buffering(unsigned buffer_size, unsigned interval_ms);
+
+    // Called from the dbus event loop whenever the sensord session had to
+    // be set up again, after sensord restarted. The sensor is running
+    // again by then if it was before
+    using SessionHandler = std::function<void()>;
+    HandlerRegistration register_session_handler(SessionHandler const& handler);
+
+    // How often sensord stopped delivering samples while the sensor was
+    // running. Can be called from any thread
+    unsigned stall_count() const;
+
+    // Only asks sensord to load the plugin for a sensor, without opening a
+    // session for it. done is called from the manager's dbus loop, the
+    // manager has to be kept alive until then
+    static void probe(
+        std::shared_ptr<Log> const& log,
+        std::shared_ptr<SensorfwManager> const& manager,
+        PluginType plugin,
+        CompletionHandler const& done);
+
 protected:
+    // Samples of a single sensord frame, preallocated for each sensor
+    static unsigned constexpr frame_capacity = 128;
+    template<typename T>
+    using SampleBuffer = SampleRing<T, frame_capacity>;
+
     virtual void data_recived_impl() = 0;
 
-    void start();
-    void stop();
+    // Only called from dbus_event_loop. The sensord calls are made
+    // asynchronously, done is called once the sensor is running or
+    // stopped, or the call failed. Later requests supersede earlier ones
+    void start(CompletionHandler const& done);
+    void stop(CompletionHandler const& done);
 
     std::shared_ptr<Log> const log;
-    DBusConnectionHandle dbus_connection;
-    DBusEventLoop dbus_event_loop;
+    std::shared_ptr<SensorfwManager> const manager;
+    DBusConnectionHandle& dbus_connection;
+    DBusEventLoop& dbus_event_loop;
     std::shared_ptr<SocketReader> m_socket;
+    // Samples are decoded and handed to the handlers on this loop, so
+    // handlers are only swapped from there
+    EventLoop& reader_loop;
+    std::atomic<OverflowPolicy> overflow_policy{OverflowPolicy::drop_oldest};
 
 private:
-    void request_sensor();
-    bool release_sensor();
-    bool load_plugin();
+    // Gets the reply, or nullptr if the call failed
+    using ReplyHandler = std::function<void(GVariant*)>;
+
+    static void call_sensord(
+        GDBusConnection* connection,
+        char const* path,
+        char const* interface,
+        char const* method,
+        GVariant* parameters,
+        GVariantType const* reply_type,
+        ReplyHandler const& handler);
+
+    void request_sensor(CompletionHandler const& done);
+    void release_sensor(int sessionid, CompletionHandler const& done);
+    static void load_plugin(
+        std::shared_ptr<Log> const& log,
+        SensorfwManager& manager,
+        PluginType plugin,
+        CompletionHandler const& done);
+    // Only called from dbus_event_loop. One call per setting is in flight
+    // at a time, what is asked for meanwhile is applied after it
+    void apply_interval();
+    void apply_buffering();
+    void wait_for_settings(CompletionHandler const& done);
+    void settings_call_done();
+    void set_session_value(char const* method, unsigned value, CompletionHandler const& done);
+    void update_running();
+    void stop_reading();
+
+    // Only called from dbus_event_loop. Once the session is lost it is
+    // requested again whenever sensord is on the bus
+    void session_lost();
+    void recover_session();
+    void session_recovered(bool success);
+
+    // Only called from dbus_event_loop. A stalled stream is restarted
+    // first, if that does not help the session is requested again
+    void arm_watchdog();
+    void check_stream();
+    void renew_session();
+    std::chrono::milliseconds stall_timeout() const;
+    static bool reports_continuously(PluginType plugin);
 
     const char* plugin_string() const;
+    static const char* plugin_string(PluginType plugin);
     const char* plugin_interface() const;
     const char* plugin_path() const;
 
-    std::thread read_loop;
+    void data_ready();
+
+    EventLoopCancellation read_watch;
+    EventLoopCancellation stream_watchdog;
+    std::atomic<std::chrono::steady_clock::duration> m_last_data{};
+    std::atomic<unsigned> m_stall_count{0};
+    unsigned m_stalls_in_row = 0;
     HandlerRegistration dbus_signal_handler_registration;
+    HandlerRegistration service_registration;
+    SessionHandler m_session_handler;
     PluginType m_plugin;
     pid_t m_pid;
-    int m_sessionid;
+    std::string const m_plugin_path;
+    int m_sessionid = -1;
     bool m_running = false;
+    bool m_wants_running = false;
+    bool m_call_pending = false;
+    bool m_session_lost = false;
+    bool m_recovering = false;
+    bool m_closing = false;
+    // Bumped whenever the session is lost, to tell replies about the old
+    // one apart
+    unsigned m_session = 0;
+    std::vector<CompletionHandler> m_start_waiters;
+    std::vector<CompletionHandler> m_stop_waiters;
+    // What was asked for, and what the session has applied
+    int m_wanted_interval = 0;
+    unsigned m_wanted_buffer_size = 0;
+    unsigned m_wanted_buffer_interval = 0;
+    int m_interval = 0;
+    unsigned m_buffer_size = 0;
+    unsigned m_buffer_interval = 0;
+    bool m_interval_pending = false;
+    bool m_buffering_pending = false;
+    std::vector<CompletionHandler> m_settings_waiters;
 };
 }
@@ -23,49 +23,67 @@
 
 namespace
 {
-auto const null_handler = [](int){};
+auto const null_handler = [](sensorfw_proxy::CompassSample const&){};
 }
 
 sensorfw_proxy::SensorfwCompassSensor::SensorfwCompassSensor(
     std::shared_ptr<Log> const& log,
-    std::string const& dbus_bus_address)
-    : Sensorfw(log, dbus_bus_address, "Compass", PluginType::COMPASS),
+    std::shared_ptr<SensorfwManager> const& manager)
+    : Sensorfw(log, manager, PluginType::COMPASS),
       handler{null_handler}
 {
+    set_overflow_policy(OverflowPolicy::decimate);
 }
 
 sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwCompassSensor::register_compass_handler(
     CompassHandler const& handler)
 {
     return EventLoopHandlerRegistration{
-        dbus_event_loop,
+        reader_loop,
         [this, &handler]{ this->handler = handler; },
         [this]{ this->handler = null_handler; }};
 }
 
-void sensorfw_proxy::SensorfwCompassSensor::enable_compass_events()
+sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwCompassSensor::register_compass_batch_handler(
+    CompassBatchHandler const& handler)
+{
+    return EventLoopHandlerRegistration{
+        reader_loop,
+        [this, &handler]{ this->batch_handler = handler; },
+        [this]{ this->batch_handler = nullptr; }};
+}
+
+void sensorfw_proxy::SensorfwCompassSensor::enable_compass_events(CompletionHandler const& done)
 {
     dbus_event_loop.enqueue(
-        [this]
+        [this, done]
         {
-            start();
-        }).get();
+            start(done);
+        });
 }
 
-void sensorfw_proxy::SensorfwCompassSensor::disable_compass_events()
+void sensorfw_proxy::SensorfwCompassSensor::disable_compass_events(CompletionHandler const& done)
 {
     dbus_event_loop.enqueue(
-        [this]
+        [this, done]
         {
-            stop();
-        }).get();
+            stop(done);
+        });
 }
 
 void sensorfw_proxy::SensorfwCompassSensor::data_recived_impl()
 {
-    QVector<CompassData> values;
-    if (!m_socket->read<CompassData>(values))
+    if (!m_socket->read(samples, overflow_policy) || samples.empty())
         return;
 
-    handler(values[0].degrees_);
+    if (batch_handler)
+    {
+        std::size_t n = 0;
+        for (auto const& value : samples.span())
+            batch[n++] = CompassSample{value.timestamp_, double(value.degrees_)};
+        batch_handler(SampleSpan<CompassSample>{batch.data(), n});
+    }
+
+    auto const& latest = samples.latest();
+    handler(CompassSample{latest.timestamp_, double(latest.degrees_)});
 }
@@ -20,6 +20,9 @@
 
 #include "compass_sensor.h"
 #include "sensorfw_common.h"
+#include "sensord_data.h"
+
+#include <array>
 
 namespace sensorfw_proxy
 {
@@ -28,16 +31,21 @@ class SensorfwCompassSensor : public CompassSensor, public Sensorfw
 {
 public:
     SensorfwCompassSensor(std::shared_ptr<Log> const& log,
-                        std::string const& dbus_bus_address);
+                        std::shared_ptr<SensorfwManager> const& manager);
 
     HandlerRegistration register_compass_handler(CompassHandler const& handler) override;
+    HandlerRegistration register_compass_batch_handler(
+        CompassBatchHandler const& handler) override;
 
-    void enable_compass_events() override;
-    void disable_compass_events() override;
+    void enable_compass_events(CompletionHandler const& done) override;
+    void disable_compass_events(CompletionHandler const& done) override;
 private:
     void data_recived_impl() override;
 
     CompassHandler handler;
+    CompassBatchHandler batch_handler;
+    SampleBuffer<CompassData> samples;
+    std::array<CompassSample, SampleBuffer<CompassData>::capacity> batch;
 };
 
 }
@@ -23,49 +23,67 @@
 
 namespace
 {
-auto const null_handler = [](double){};
+auto const null_handler = [](sensorfw_proxy::LightSample const&){};
 }
 
 sensorfw_proxy::SensorfwLightSensor::SensorfwLightSensor(
     std::shared_ptr<Log> const& log,
-    std::string const& dbus_bus_address)
-    : Sensorfw(log, dbus_bus_address, "Light", PluginType::LIGHT),
+    std::shared_ptr<SensorfwManager> const& manager)
+    : Sensorfw(log, manager, PluginType::LIGHT),
       handler{null_handler}
 {
+    set_overflow_policy(OverflowPolicy::keep_latest);
 }
 
 sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwLightSensor::register_light_handler(
     LightHandler const& handler)
 {
     return EventLoopHandlerRegistration{
-        dbus_event_loop,
+        reader_loop,
         [this, &handler]{ this->handler = handler; },
         [this]{ this->handler = null_handler; }};
 }
 
-void sensorfw_proxy::SensorfwLightSensor::enable_light_events()
+sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwLightSensor::register_light_batch_handler(
+    LightBatchHandler const& handler)
+{
+    return EventLoopHandlerRegistration{
+        reader_loop,
+        [this, &handler]{ this->batch_handler = handler; },
+        [this]{ this->batch_handler = nullptr; }};
+}
+
+void sensorfw_proxy::SensorfwLightSensor::enable_light_events(CompletionHandler const& done)
 {
     dbus_event_loop.enqueue(
-        [this]
+        [this, done]
         {
-            start();
-        }).get();
+            start(done);
+        });
 }
 
-void sensorfw_proxy::SensorfwLightSensor::disable_light_events()
+void sensorfw_proxy::SensorfwLightSensor::disable_light_events(CompletionHandler const& done)
 {
     dbus_event_loop.enqueue(
-        [this]
+        [this, done]
         {
-            stop();
-        }).get();
+            stop(done);
+        });
 }
 
 void sensorfw_proxy::SensorfwLightSensor::data_recived_impl()
 {
-    QVector<TimedUnsigned> values;
-    if (!m_socket->read<TimedUnsigned>(values))
+    if (!m_socket->read(samples, overflow_policy) || samples.empty())
         return;
 
-    handler(values[0].value_);
+    if (batch_handler)
+    {
+        std::size_t n = 0;
+        for (auto const& value : samples.span())
+            batch[n++] = LightSample{value.timestamp_, double(value.value_)};
+        batch_handler(SampleSpan<LightSample>{batch.data(), n});
+    }
+
+    auto const& latest = samples.latest();
+    handler(LightSample{latest.timestamp_, double(latest.value_)});
 }
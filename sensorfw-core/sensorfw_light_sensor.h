@@ -20,6 +20,9 @@
 
 #include "light_sensor.h"
 #include "sensorfw_common.h"
+#include "sensord_data.h"
+
+#include <array>
 
 namespace sensorfw_proxy
 {
@@ -28,16 +31,21 @@ class SensorfwLightSensor : public LightSensor, public Sensorfw
 {
 public:
     SensorfwLightSensor(std::shared_ptr<Log> const& log,
-                        std::string const& dbus_bus_address);
+                        std::shared_ptr<SensorfwManager> const& manager);
 
     HandlerRegistration register_light_handler(LightHandler const& handler) override;
+    HandlerRegistration register_light_batch_handler(
+        LightBatchHandler const& handler) override;
 
-    void enable_light_events() override;
-    void disable_light_events() override;
+    void enable_light_events(CompletionHandler const& done) override;
+    void disable_light_events(CompletionHandler const& done) override;
 private:
     void data_recived_impl() override;
 
     LightHandler handler;
+    LightBatchHandler batch_handler;
+    SampleBuffer<TimedUnsigned> samples;
+    std::array<LightSample, SampleBuffer<TimedUnsigned>::capacity> batch;
 };
 
 }
@@ -0,0 +1,142 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sensorfw_manager.h"
+#include "event_loop_handler_registration.h"
+
+#include <memory>
+
+namespace
+{
+char const* const dbus_sensorfw_name = "com.nokia.SensorService";
+}
+
+sensorfw_proxy::SensorfwManager::SensorfwManager(std::string const& dbus_bus_address)
+    : dbus_connection{dbus_bus_address},
+      dbus_event_loop{"Sensorfw"},
+      reader_event_loop{"SensorfwReader"}
+{
+    // The watch reports on the loop it was added from
+    dbus_event_loop.enqueue(
+        [this]
+        {
+            name_watch_id = g_bus_watch_name_on_connection(
+                dbus_connection,
+                dbus_sensorfw_name,
+                G_BUS_NAME_WATCHER_FLAGS_NONE,
+                &SensorfwManager::name_appeared,
+                &SensorfwManager::name_vanished,
+                this,
+                nullptr);
+        }).wait();
+}
+
+sensorfw_proxy::SensorfwManager::~SensorfwManager()
+{
+    dbus_event_loop.enqueue(
+        [this]
+        {
+            g_bus_unwatch_name(name_watch_id);
+        }).wait();
+}
+
+sensorfw_proxy::DBusConnectionHandle& sensorfw_proxy::SensorfwManager::connection()
+{
+    return dbus_connection;
+}
+
+sensorfw_proxy::DBusEventLoop& sensorfw_proxy::SensorfwManager::dbus_loop()
+{
+    return dbus_event_loop;
+}
+
+sensorfw_proxy::EventLoop& sensorfw_proxy::SensorfwManager::reader_loop()
+{
+    return reader_event_loop;
+}
+
+void sensorfw_proxy::SensorfwManager::wait_for_service(
+    std::chrono::milliseconds timeout, CompletionHandler const& ready)
+{
+    if (service_owned)
+    {
+        ready(true);
+        return;
+    }
+
+    // Whichever comes first, sensord or the timeout, completes the wait
+    auto const pending = std::make_shared<CompletionHandler>(ready);
+    auto const complete =
+        [pending] (bool owned)
+        {
+            if (!*pending)
+                return;
+
+            auto const done = std::move(*pending);
+            *pending = nullptr;
+            done(owned);
+        };
+
+    service_waiters.push_back(complete);
+    dbus_event_loop.enqueue_after(timeout, [complete] { complete(false); });
+}
+
+sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwManager::register_service_handler(
+    ServiceHandler const& handler)
+{
+    auto const id = next_service_handler++;
+    service_handlers[id] = handler;
+
+    return EventLoopHandlerRegistration{
+        dbus_event_loop,
+        [this, id] { service_handlers.erase(id); }};
+}
+
+// A handler may register another one while being called, so they are
+// called from a copy
+void sensorfw_proxy::SensorfwManager::notify_service_handlers(bool owned)
+{
+    std::vector<ServiceHandler> handlers;
+    for (auto const& entry : service_handlers)
+        handlers.push_back(entry.second);
+
+    for (auto const& handler : handlers)
+        handler(owned);
+}
+
+void sensorfw_proxy::SensorfwManager::name_appeared(
+    GDBusConnection*, char const*, char const*, gpointer user_data)
+{
+    auto const manager = static_cast<SensorfwManager*>(user_data);
+    auto const waiters = std::move(manager->service_waiters);
+
+    manager->service_waiters.clear();
+    manager->service_owned = true;
+
+    for (auto const& ready : waiters)
+        ready(true);
+
+    manager->notify_service_handlers(true);
+}
+
+void sensorfw_proxy::SensorfwManager::name_vanished(
+    GDBusConnection*, char const*, gpointer user_data)
+{
+    auto const manager = static_cast<SensorfwManager*>(user_data);
+
+    manager->service_owned = false;
+    manager->notify_service_handlers(false);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "completion_handler.h"
+#include "dbus_connection_handle.h"
+#include "dbus_event_loop.h"
+#include "handler_registration.h"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sensorfw_proxy
+{
+
+/**
+ * What all sensorfw backends share: one connection to the bus sensord is
+ * on, the event loop its calls are made and answered on, and the thread
+ * reading the sensord data sockets. It also keeps track of whether sensord
+ * is on the bus.
+ */
+class SensorfwManager
+{
+public:
+    using ServiceHandler = std::function<void(bool owned)>;
+
+    explicit SensorfwManager(std::string const& dbus_bus_address);
+    ~SensorfwManager();
+
+    DBusConnectionHandle& connection();
+    DBusEventLoop& dbus_loop();
+    EventLoop& reader_loop();
+
+    // Only called from dbus_loop(). Calls ready with true as soon as
+    // sensord owns its name, or with false if it did not within timeout
+    void wait_for_service(std::chrono::milliseconds timeout, CompletionHandler const& ready);
+
+    // Only called from dbus_loop(). The handler is called there whenever
+    // sensord appears on or vanishes from the bus
+    HandlerRegistration register_service_handler(ServiceHandler const& handler);
+
+private:
+    SensorfwManager(SensorfwManager const&) = delete;
+    SensorfwManager& operator=(SensorfwManager const&) = delete;
+
+    static void name_appeared(GDBusConnection* connection, char const* name,
+                              char const* name_owner, gpointer user_data);
+    static void name_vanished(GDBusConnection* connection, char const* name,
+                              gpointer user_data);
+    void notify_service_handlers(bool owned);
+
+    DBusConnectionHandle dbus_connection;
+    DBusEventLoop dbus_event_loop;
+    EventLoop reader_event_loop;
+
+    // Only used from dbus_event_loop
+    guint name_watch_id = 0;
+    bool service_owned = false;
+    std::vector<CompletionHandler> service_waiters;
+    std::map<int, ServiceHandler> service_handlers;
+    int next_service_handler = 0;
+};
+
+}
@@ -23,50 +23,67 @@
 
 namespace
 {
-auto const null_handler = [](sensorfw_proxy::OrientationData){};
+auto const null_handler = [](sensorfw_proxy::OrientationSample const&){};
 }
 
 sensorfw_proxy::SensorfwOrientationSensor::SensorfwOrientationSensor(
     std::shared_ptr<Log> const &log,
-    std::string const &dbus_bus_address)
-    : Sensorfw(log, dbus_bus_address, "Orientation", PluginType::ORIENTATION),
+    std::shared_ptr<SensorfwManager> const& manager)
+    : Sensorfw(log, manager, PluginType::ORIENTATION),
       handler{null_handler}
 {
+    set_overflow_policy(OverflowPolicy::keep_latest);
 }
 
 sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwOrientationSensor::register_orientation_handler(
     OrientationHandler const &handler)
 {
     return EventLoopHandlerRegistration{
-        dbus_event_loop,
+        reader_loop,
         [this, &handler]{ this->handler = handler; },
         [this]{ this->handler = null_handler; }};
 }
 
-void sensorfw_proxy::SensorfwOrientationSensor::enable_orientation_events()
+sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwOrientationSensor::register_orientation_batch_handler(
+    OrientationBatchHandler const& handler)
+{
+    return EventLoopHandlerRegistration{
+        reader_loop,
+        [this, &handler]{ this->batch_handler = handler; },
+        [this]{ this->batch_handler = nullptr; }};
+}
+
+void sensorfw_proxy::SensorfwOrientationSensor::enable_orientation_events(CompletionHandler const& done)
 {
     dbus_event_loop.enqueue(
-        [this]
+        [this, done]
         {
-            start();
-        }).get();
+            start(done);
+        });
 }
 
-void sensorfw_proxy::SensorfwOrientationSensor::disable_orientation_events()
+void sensorfw_proxy::SensorfwOrientationSensor::disable_orientation_events(CompletionHandler const& done)
 {
     dbus_event_loop.enqueue(
-        [this]
+        [this, done]
         {
-            stop();
-        }).get();
+            stop(done);
+        });
 }
 
 void sensorfw_proxy::SensorfwOrientationSensor::data_recived_impl()
 {
-    QVector<PoseData> values;
-    sensorfw_proxy::OrientationData output;
-    if (m_socket->read<PoseData>(values))
-        output = (sensorfw_proxy::OrientationData) values[0].orientation_;
+    if (!m_socket->read(samples, overflow_policy) || samples.empty())
+        return;
+
+    if (batch_handler)
+    {
+        std::size_t n = 0;
+        for (auto const& value : samples.span())
+            batch[n++] = OrientationSample{value.timestamp_, (sensorfw_proxy::OrientationData) value.orientation_};
+        batch_handler(SampleSpan<OrientationSample>{batch.data(), n});
+    }
 
-    handler(output);
+    auto const& latest = samples.latest();
+    handler(OrientationSample{latest.timestamp_, (sensorfw_proxy::OrientationData) latest.orientation_});
 }
@@ -20,6 +20,9 @@
 
 #include "orientation_sensor.h"
 #include "sensorfw_common.h"
+#include "sensord_data.h"
+
+#include <array>
 
 namespace sensorfw_proxy
 {
@@ -28,16 +31,21 @@ class SensorfwOrientationSensor : public OrientationSensor, public Sensorfw
 {
 public:
     SensorfwOrientationSensor(std::shared_ptr<Log> const& log,
-                        std::string const& dbus_bus_address);
+                        std::shared_ptr<SensorfwManager> const& manager);
 
     HandlerRegistration register_orientation_handler(OrientationHandler const& handler) override;
+    HandlerRegistration register_orientation_batch_handler(
+        OrientationBatchHandler const& handler) override;
 
-    void enable_orientation_events() override;
-    void disable_orientation_events() override;
+    void enable_orientation_events(CompletionHandler const& done) override;
+    void disable_orientation_events(CompletionHandler const& done) override;
 private:
     void data_recived_impl() override;
 
     OrientationHandler handler;
+    OrientationBatchHandler batch_handler;
+    SampleBuffer<PoseData> samples;
+    std::array<OrientationSample, SampleBuffer<PoseData>::capacity> batch;
 };
 
 }
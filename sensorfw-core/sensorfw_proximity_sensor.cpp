@@ -23,54 +23,71 @@
 
 namespace
 {
-auto const null_handler = [](sensorfw_proxy::ProximityState){};
+auto const null_handler = [](sensorfw_proxy::ProximitySample const&){};
 }
 
 sensorfw_proxy::SensorfwProximitySensor::SensorfwProximitySensor(
     std::shared_ptr<Log> const& log,
-    std::string const& dbus_bus_address)
-    : Sensorfw(log, dbus_bus_address, "Proximity", PluginType::PROXIMITY),
+    std::shared_ptr<SensorfwManager> const& manager)
+    : Sensorfw(log, manager, PluginType::PROXIMITY),
       m_handler{null_handler},
       m_state{ProximityState::far}
 {
+    set_overflow_policy(OverflowPolicy::keep_latest);
 }
 
 sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwProximitySensor::register_proximity_handler(
     ProximityHandler const& handler)
 {
     return EventLoopHandlerRegistration{
-        dbus_event_loop,
+        reader_loop,
         [this, &handler]{ this->m_handler = handler; },
         [this]{ this->m_handler = null_handler; }};
 }
 
-void sensorfw_proxy::SensorfwProximitySensor::enable_proximity_events()
+sensorfw_proxy::HandlerRegistration sensorfw_proxy::SensorfwProximitySensor::register_proximity_batch_handler(
+    ProximityBatchHandler const& handler)
+{
+    return EventLoopHandlerRegistration{
+        reader_loop,
+        [this, &handler]{ this->m_batch_handler = handler; },
+        [this]{ this->m_batch_handler = nullptr; }};
+}
+
+void sensorfw_proxy::SensorfwProximitySensor::enable_proximity_events(CompletionHandler const& done)
 {
     dbus_event_loop.enqueue(
-        [this]
+        [this, done]
         {
-            start();
-        }).get();
+            start(done);
+        });
 }
 
-void sensorfw_proxy::SensorfwProximitySensor::disable_proximity_events()
+void sensorfw_proxy::SensorfwProximitySensor::disable_proximity_events(CompletionHandler const& done)
 {
     dbus_event_loop.enqueue(
-        [this]
+        [this, done]
         {
-            stop();
-        }).get();
+            stop(done);
+        });
 }
 
 void sensorfw_proxy::SensorfwProximitySensor::data_recived_impl()
 {
-    QVector<ProximityData> values;
-    if (m_socket->read<ProximityData>(values))
-        m_state = values[0].withinProximity_ ? ProximityState::near : ProximityState::far;
-    else
-        m_state = ProximityState::far;
+    if (!m_socket->read(m_samples, overflow_policy) || m_samples.empty())
+        return;
+
+    if (m_batch_handler)
+    {
+        std::size_t n = 0;
+        for (auto const& value : m_samples.span())
+            m_batch[n++] = ProximitySample{value.timestamp_, value.withinProximity_ ? ProximityState::near : ProximityState::far};
+        m_batch_handler(SampleSpan<ProximitySample>{m_batch.data(), n});
+    }
 
-    m_handler(m_state);
+    auto const& latest = m_samples.latest();
+    m_state = latest.withinProximity_ ? ProximityState::near : ProximityState::far;
+    m_handler(ProximitySample{latest.timestamp_, m_state});
 }
 
 sensorfw_proxy::ProximityState sensorfw_proxy::SensorfwProximitySensor::proximity_state()
@@ -20,6 +20,9 @@
 
 #include "proximity_sensor.h"
 #include "sensorfw_common.h"
+#include "sensord_data.h"
+
+#include <array>
 
 namespace sensorfw_proxy
 {
@@ -28,19 +31,24 @@ class SensorfwProximitySensor : public ProximitySensor, public Sensorfw
 {
 public:
     SensorfwProximitySensor(std::shared_ptr<Log> const& log,
-                        std::string const& dbus_bus_address);
+                        std::shared_ptr<SensorfwManager> const& manager);
 
     HandlerRegistration register_proximity_handler(
         ProximityHandler const& handler) override;
+    HandlerRegistration register_proximity_batch_handler(
+        ProximityBatchHandler const& handler) override;
     ProximityState proximity_state() override;
 
-    void enable_proximity_events() override;
-    void disable_proximity_events() override;
+    void enable_proximity_events(CompletionHandler const& done) override;
+    void disable_proximity_events(CompletionHandler const& done) override;
 
 private:
     void data_recived_impl() override;
 
     ProximityHandler m_handler;
+    ProximityBatchHandler m_batch_handler;
+    SampleBuffer<ProximityData> m_samples;
+    std::array<ProximitySample, SampleBuffer<ProximityData>::capacity> m_batch;
     sensorfw_proxy::ProximityState m_state;
 };
 
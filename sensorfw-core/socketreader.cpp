@@ -26,10 +26,22 @@
 
 #include "socketreader.h"
 
-SocketReader::SocketReader(QObject* parent) :
-    QObject(parent),
-    socket_(NULL),
-    tagRead_(false)
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+char const* const log_tag = "SocketReader";
+}
+
+SocketReader::SocketReader(std::shared_ptr<sensorfw_proxy::Log> const& log) :
+    log_(log),
+    tagRead_(false),
+    lost_(false),
+    inFrame_(false),
+    objectsLeft_(0),
+    bufferLength_(0),
+    bufferPos_(0)
 {
 }
 
@@ -41,30 +53,40 @@ SocketReader::~SocketReader()
 
 bool SocketReader::initiateConnection(int sessionId)
 {
-    if (socket_ != NULL) {
-        qDebug() << "attempting to initiate connection on connected socket";
+    if (socket_) {
+        log_->log(log_tag, "attempting to initiate connection on connected socket");
         return false;
     }
 
-    socket_ = new QLocalSocket(this);
-    const char* SOCKET_NAME = "/var/run/sensord.sock";
-    QByteArray env = qgetenv("SENSORFW_SOCKET_PATH");
-    if (!env.isEmpty()) {
-        env += SOCKET_NAME;
-        SOCKET_NAME = env;
+    std::string socketName = "/var/run/sensord.sock";
+    char const* env = std::getenv("SENSORFW_SOCKET_PATH");
+    if (env && *env)
+        socketName = env + socketName;
+
+    auto socket = sensorfw_proxy::make_sensord_socket();
+    if (!socket->connect(socketName)) {
+        log_->log(log_tag, "Failed to connect to %s: %s",
+                  socketName.c_str(), socket->error_string().c_str());
+        return false;
     }
 
-    socket_->connectToServer(SOCKET_NAME, QIODevice::ReadWrite);
+    return initiateConnection(std::move(socket), sessionId);
+}
 
-    if (!(socket_->serverName().size())) {
-        qDebug() << socket_->errorString();
+bool SocketReader::initiateConnection(std::unique_ptr<sensorfw_proxy::SensordSocket> socket,
+                                      int sessionId)
+{
+    if (socket_) {
+        log_->log(log_tag, "attempting to initiate connection on connected socket");
         return false;
     }
 
-    if (socket_->write((const char*)&sessionId, sizeof(sessionId)) != sizeof(sessionId)) {
-        qDebug() << "[SOCKETREADER]: SessionId write failed: " << socket_->errorString();
+    socket_ = std::move(socket);
+    lost_ = false;
+
+    if (!socket_->write(&sessionId, sizeof(sessionId))) {
+        log_->log(log_tag, "SessionId write failed: %s", socket_->error_string().c_str());
     }
-    socket_->flush();
     readSocketTag();
 
     return true;
@@ -75,51 +97,63 @@ bool SocketReader::dropConnection()
     if (!socket_)
         return false;
 
-    socket_->disconnectFromServer();
-    if (socket_->state() != QLocalSocket::UnconnectedState)
-        socket_->waitForDisconnected();
-    delete socket_;
-    socket_ = NULL;
+    socket_->disconnect();
+    socket_.reset();
 
     tagRead_ = false;
+    inFrame_ = false;
+    bufferLength_ = 0;
+    bufferPos_ = 0;
 
     return true;
 }
 
-QLocalSocket* SocketReader::socket()
+int SocketReader::descriptor() const
 {
-    return socket_;
+    return socket_ ? socket_->descriptor() : -1;
+}
+
+bool SocketReader::receive()
+{
+    if (!socket_ || lost_)
+        return false;
+
+    // Keep the undecoded tail of the previous read, it is the start of a
+    // header or object whose remaining bytes are about to arrive
+    if (bufferPos_ > 0)
+    {
+        std::memmove(buffer_, buffer_ + bufferPos_, pending());
+        bufferLength_ -= bufferPos_;
+        bufferPos_ = 0;
+    }
+
+    int bytes = socket_->read(buffer_ + bufferLength_, bufferSize_ - bufferLength_);
+    if (bytes < 0)
+    {
+        log_->log(log_tag, "Error occured while reading data from socket: %s",
+                  socket_->error_string().c_str());
+        resetFrame();
+        lost_ = true;
+        return false;
+    }
+
+    bufferLength_ += bytes;
+    return bufferLength_ == bufferSize_;
 }
 
 bool SocketReader::readSocketTag()
 {
     char foo;
-    socket_->waitForReadyRead();
-    tagRead_ = read(&foo, 1);
+    socket_->wait_for_data(30000);
+    // If the tag is not there yet read() will pick it up later
+    tagRead_ = (socket_->read(&foo, 1) == 1);
     return true;
 }
 
-bool SocketReader::read(void* buffer, int size)
+void SocketReader::resetFrame()
 {
-    int bytesRead = 0;
-    int retry = 100;
-    while (bytesRead < size)
-    {
-        int bytes = socket_->read((char *)buffer + bytesRead, size);
-        if (bytes == 0)
-        {
-            if (!retry)
-                return false;
-            struct timespec ts;
-            ts.tv_sec = 0;
-            ts.tv_nsec = 100000000;
-            nanosleep( &ts, NULL );
-            --retry;
-            continue;
-        }
-        if (bytes < 1)
-            return false;
-        bytesRead += bytes;
-    }
-    return (bytesRead > 0);
+    socket_->discard();
+    inFrame_ = false;
+    bufferLength_ = 0;
+    bufferPos_ = 0;
 }
@@ -26,167 +26,12 @@
 
 #pragma once
 
-#include <QLocalSocket>
+#include "log.h"
+#include "sensord_data.h"
+#include "sensord_socket.h"
+#include "sample_ring.h"
 
-class TimedData
-{
-public:
-
-    /**
-     * Constructor
-     *
-     * @param timestamp monotonic time (microsec)
-     */
-    TimedData(const quint64& timestamp) : timestamp_(timestamp) {}
-
-    quint64 timestamp_;  /**< monotonic time (microsec) */
-};
-
-class TimedUnsigned : public TimedData {
-public:
-    /**
-     * Default constructor.
-     */
-    TimedUnsigned() : TimedData(0), value_(0) {}
-
-    /**
-     * Constructor.
-     *
-     * @param timestamp timestamp as monotonic time (microsec).
-     * @param value value of the measurement.
-     */
-    TimedUnsigned(const quint64& timestamp, unsigned value) : TimedData(timestamp), value_(value) {}
-
-    unsigned value_; /**< Measurement value. */
-};
-
-class ProximityData : public TimedUnsigned
-{
-public:
-    /**
-     * Default constructor.
-     */
-    ProximityData() : TimedUnsigned(), withinProximity_(false) {}
-
-    /**
-     * Constructor
-     *
-     * @param timestamp timestamp as monotonic time (microsec).
-     * @param value raw proximity value.
-     * @param withinProximity is there an object within proximity.
-     */
-    ProximityData(const quint64& timestamp, unsigned int value, bool withinProximity) :
-        TimedUnsigned(timestamp, value), withinProximity_(withinProximity) {}
-
-    bool withinProximity_; /**< is an object within proximity or not */
-};
-
-/**
- * Datatype for device pose interpretation.
- */
-class PoseData : public TimedData {
-public:
-    /**
-     * Possible device postures.
-     * @note The interpretation algorithm for orientation currently relies on the
-     *       integer values of the enumeration. Thus changing the names for the
-     *       orientation states is completely ok (for sensord, client apps may
-     *       disagree). Possible new values must be appended to the list and the
-     *       order of values must not be changed!
-     *
-     * Device side naming:
-     * @verbatim
-                          Top
-                      ----------
-                     /  NOKIA  /|
-                    /-------- / |
-                   //       //  /
-                  //       //  /
-          Left   //  Face //  /    Right
-                //       //  /
-               //       //  /
-              /---------/  /
-             /    O    /  /
-            /         /  /
-            ----------  /
-            |_________!/
-              Bottom
-       @endverbatim
-     */
-
-    /**
-     * Device orientation.
-     */
-    enum Orientation
-    {
-        Undefined = 0, /**< Orientation is unknown. */
-        LeftUp,        /**< Device left side is up */
-        RightUp,       /**< Device right side is up */
-        BottomUp,      /**< Device bottom is up */
-        BottomDown,    /**< Device bottom is down */
-        FaceDown,      /**< Device face is down */
-        FaceUp         /**< Device face is up */
-    };
-
-    PoseData::Orientation orientation_; /**< Device Orientation */
-
-    /**
-     * Constructor.
-     */
-    PoseData() : TimedData(0), orientation_(Undefined) {}
-
-    /**
-     * Constructor.
-     * @param orientation Initial value for orientation.
-     */
-    PoseData(Orientation orientation) : TimedData(0), orientation_(orientation) {}
-
-    /**
-     * Constructor
-     * @param timestamp Initial value for timestamp.
-     * @param orientation Initial value for orientation.
-     */
-    PoseData(const quint64& timestamp, Orientation orientation) : TimedData(timestamp), orientation_(orientation) {}
-};
-
-/**
- * Datatype for compass measurements.
- */
-class CompassData : public TimedData
-{
-public:
-    /**
-     * Default constructor.
-     */
-    CompassData() : TimedData(0), degrees_(0), rawDegrees_(0), correctedDegrees_(0), level_(0) {}
-
-    /**
-     * Constructor.
-     *
-     * @param timestamp timestamp as monotonic time (microsec).
-     * @param degrees Angle to north.
-     * @param level Magnetometer calibration level.
-     */
-    CompassData(const quint64& timestamp, int degrees, int level) :
-        TimedData(timestamp), degrees_(degrees), rawDegrees_(degrees), correctedDegrees_(0), level_(level) {}
-
-    /**
-     * Constructor.
-     *
-     * @param timestamp timestamp as monotonic time (microsec).
-     * @param degrees Angle to north.
-     * @param level Magnetometer calibration level.
-     * @param correctedDegrees Declination corrected angle to north.
-     * @param rawDegrees Not declination corrected angle to north.
-     */
-    CompassData(const quint64& timestamp, int degrees, int level, int correctedDegrees, int rawDegrees) :
-        TimedData(timestamp), degrees_(degrees), rawDegrees_(rawDegrees), correctedDegrees_(correctedDegrees), level_(level) {}
-
-    int degrees_; /**< Angle to north which may be declination corrected or not. This is the value apps should use */
-    int rawDegrees_; /**< Angle to north without declination correction */
-    int correctedDegrees_; /**< Declination corrected angle to north */
-    int level_;   /**< Magnetometer calibration level. Higher value means better calibration. */
-};
+#include <cstring>
 
 /**
  * @brief Helper class for reading socket datachannel from sensord
@@ -195,19 +40,16 @@ public:
  * data channel. It is used by AbstractSensorChannelInterface to maintain
  * the socket connection to the server.
  */
-class SocketReader : public QObject
+class SocketReader
 {
-    Q_OBJECT
-    Q_DISABLE_COPY(SocketReader)
-
 public:
 
     /**
      * Constructor.
      *
-     * @param parent Parent QObject.
+     * @param log Log to report socket errors to.
      */
-    SocketReader(QObject* parent = 0);
+    SocketReader(std::shared_ptr<sensorfw_proxy::Log> const& log);
 
     /**
      * Destructor.
@@ -222,6 +64,17 @@ public:
      */
     bool initiateConnection(int sessionId);
 
+    /**
+     * Initiates new data socket connection over a socket that is
+     * connected already.
+     *
+     * @param socket Connected socket to sensord.
+     * @param sessionId ID for the current session.
+     * @return was the connection established successfully.
+     */
+    bool initiateConnection(std::unique_ptr<sensorfw_proxy::SensordSocket> socket,
+                            int sessionId);
+
     /**
      * Drops socket connection.
      * @return was the connection successfully closed.
@@ -229,35 +82,49 @@ public:
     bool dropConnection();
 
     /**
-     * Provides access to the internal QLocalSocket for direct reading.
+     * Provides the file descriptor of the data connection, to watch it
+     * for readability.
      *
-     * @return Pointer to the internal QLocalSocket. Pointer can be \c NULL
-     *         if \c initiateConnection() has not been called successfully.
+     * @return The descriptor, or -1 if \c initiateConnection() has not
+     *         been called successfully.
      */
-    QLocalSocket* socket();
+    int descriptor() const;
 
     /**
-     * Attempt to read given number of bytes from the socket. As
-     * QLocalSocket is used, we are guaranteed that any number of bytes
-     * written in single operation are available for immediate reading
-     * with a single operation.
+     * Pull everything the socket has for us into the receive buffer with a
+     * single read. Call after the descriptor became readable, followed by
+     * \c read() to decode the frames.
      *
-     * @param size Number of bytes to read.
-     * @param buffer Location for storing the data.
-     * @return was given amount of bytes read succesfully.
+     * @return true if the receive buffer was filled up completely, in
+     *         which case more data may be waiting in the socket.
+     */
+    bool receive();
+
+    /**
+     * @return true if sensord closed the connection, reading from it
+     *         failed or the stream turned out to be corrupt. Stays
+     *         set until \c initiateConnection() is called again.
      */
-    bool read(void* buffer, int size);
+    bool connectionLost() const { return lost_; }
 
     /**
-     * Attempt to read objects from the sockets. The call blocks until
-     * there are minimum amount of expected bytes availabled in the socket.
+     * Decode all complete objects in the receive buffer, walking through
+     * as many frames as it holds. Bytes of a header or object that has
+     * not been received completely stay in the buffer until the next
+     * \c receive(), so a split frame never needs to be waited for.
+     *
+     * The ring is cleared first and the objects are copied into it. A
+     * backlog larger than the ring is walked through without buffering
+     * it, the policy decides which of the objects are kept.
      *
-     * @param values Vector to which objects will be appended.
+     * @param ring Ring the objects will be stored in.
+     * @param policy What to keep if there are more objects than fit.
      * @tparam T type of expected object in the stream.
-     * @return true if atleast one object was read.
+     * @return true if at least one object was decoded.
      */
-    template<typename T>
-    bool read(QVector<T>& values);
+    template<typename T, std::size_t N>
+    bool read(sensorfw_proxy::SampleRing<T, N>& ring,
+              sensorfw_proxy::OverflowPolicy policy);
 
 private:
     /**
@@ -265,34 +132,82 @@ private:
      */
     bool readSocketTag();
 
-    QLocalSocket* socket_; /**< socket data connection to sensord */
+    /**
+     * Forget about the frame being decoded and discard buffered data.
+     */
+    void resetFrame();
+
+    /**
+     * @return number of received bytes that have not been decoded yet.
+     */
+    unsigned int pending() const { return bufferLength_ - bufferPos_; }
+
+    SocketReader(SocketReader const&) = delete;
+    SocketReader& operator=(SocketReader const&) = delete;
+
+    std::shared_ptr<sensorfw_proxy::Log> const log_; /**< log for socket errors */
+    std::unique_ptr<sensorfw_proxy::SensordSocket> socket_; /**< socket data connection to sensord */
     bool tagRead_; /**< is initial magic byte read from the socket */
+    bool lost_; /**< has the connection been closed or broken */
+
+    bool inFrame_; /**< has the header of the current frame been decoded */
+    unsigned int objectsLeft_; /**< objects of the current frame still to decode */
+    static unsigned int const maxObjects_ = 65536; /**< larger counts mean a corrupt stream */
+
+    static unsigned int const bufferSize_ = 16384;
+    alignas(64) char buffer_[bufferSize_]; /**< receive buffer, reused for every read */
+    unsigned int bufferLength_; /**< bytes held in the receive buffer */
+    unsigned int bufferPos_; /**< bytes of the receive buffer already decoded */
 };
 
-template<typename T>
-bool SocketReader::read(QVector<T>& values)
+template<typename T, std::size_t N>
+bool SocketReader::read(sensorfw_proxy::SampleRing<T, N>& ring,
+                        sensorfw_proxy::OverflowPolicy policy)
 {
-    if (!socket_)
-        return false;
+    ring.clear(policy);
 
-    unsigned int count;
-    if (!read((void*)&count, sizeof(unsigned int)))
-    {
-        socket_->readAll();
-        return false;
-    }
-    if (count > 1000)
+    if (!tagRead_)
     {
-        qWarning() << "Too many samples waiting in socket. Flushing it to empty";
-        socket_->readAll();
-        return false;
+        if (pending() < 1)
+            return false;
+        ++bufferPos_;
+        tagRead_ = true;
     }
-    values.resize(values.size() + count);
-    if (!read((void*)values.data(), sizeof(T) * count))
+
+    while (true)
     {
-        qWarning() << "Error occured while reading data from socket: " << socket_->errorString();
-        socket_->readAll();
-        return false;
+        if (!inFrame_)
+        {
+            if (pending() < sizeof(objectsLeft_))
+                break;
+
+            std::memcpy(&objectsLeft_, buffer_ + bufferPos_, sizeof(objectsLeft_));
+            bufferPos_ += sizeof(objectsLeft_);
+            inFrame_ = true;
+
+            // Not something sensord would send, the stream is out of step
+            if (objectsLeft_ > maxObjects_)
+            {
+                log_->log("SocketReader", "Frame of %u objects, dropping the corrupt stream", objectsLeft_);
+                resetFrame();
+                lost_ = true;
+                break;
+            }
+        }
+
+        while (objectsLeft_ > 0 && pending() >= sizeof(T))
+        {
+            std::memcpy((void *)ring.next_slot(), buffer_ + bufferPos_, sizeof(T));
+            bufferPos_ += sizeof(T);
+            ring.commit();
+            --objectsLeft_;
+        }
+
+        if (objectsLeft_ > 0)
+            break;
+
+        inFrame_ = false;
     }
-    return true;
+
+    return !ring.empty();
 }
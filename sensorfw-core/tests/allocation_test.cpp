@@ -0,0 +1,528 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Checks that nothing is allocated per sample once a sensor is running:
+// first for SocketReader decoding frames into a SampleRing, then for a
+// light sensor talking to a fake sensord, from the data socket through
+// its batch handler into a SampleQueue
+
+#include "console_log.h"
+#include "sample_queue.h"
+#include "sensord_data.h"
+#include "sensorfw_light_sensor.h"
+#include "sensorfw_manager.h"
+#include "scoped_g_error.h"
+#include "socketreader.h"
+#include "unix_sensord_socket.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <new>
+#include <string>
+#include <thread>
+
+#include <gio/gio.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+std::atomic<std::size_t> allocations{0};
+
+void* allocate(std::size_t size, std::size_t alignment)
+{
+    ++allocations;
+
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, std::max(alignment, sizeof(void*)), size ? size : 1) != 0)
+        throw std::bad_alloc{};
+
+    return ptr;
+}
+}
+
+void* operator new(std::size_t size) { return allocate(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return allocate(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t al) { return allocate(size, static_cast<std::size_t>(al)); }
+void* operator new[](std::size_t size, std::align_val_t al) { return allocate(size, static_cast<std::size_t>(al)); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+namespace
+{
+unsigned constexpr frame_size = 200;
+int constexpr warmup_rounds = 8;
+int constexpr rounds = 1000;
+
+using Ring = sensorfw_proxy::SampleRing<TimedUnsigned, 128>;
+
+bool write_all(int fd, void const* buffer, std::size_t size)
+{
+    auto bytes = static_cast<char const*>(buffer);
+
+    while (size > 0)
+    {
+        auto const written = ::write(fd, bytes, size);
+        if (written <= 0)
+            return false;
+        bytes += written;
+        size -= written;
+    }
+
+    return true;
+}
+
+// One frame as sensord sends it: the number of samples, then the samples
+bool write_frame(int fd, unsigned first_value, unsigned count = frame_size)
+{
+    std::array<TimedUnsigned, frame_size> samples;
+    for (unsigned i = 0; i < count; ++i)
+        samples[i] = TimedUnsigned{first_value + i, first_value + i};
+
+    return write_all(fd, &count, sizeof(count)) &&
+           write_all(fd, samples.data(), count * sizeof(TimedUnsigned));
+}
+
+bool run(sensorfw_proxy::OverflowPolicy policy, char const* name)
+{
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0)
+    {
+        std::perror("socketpair");
+        return false;
+    }
+    int const sensord = fds[1];
+
+    // sensord answers the session id with a tag byte
+    char const tag = '\n';
+    write_all(sensord, &tag, 1);
+
+    auto const log = std::make_shared<sensorfw_proxy::ConsoleLog>();
+    auto const reader = std::make_unique<SocketReader>(log);
+    auto const ring = std::make_unique<Ring>();
+    bool ok = reader->initiateConnection(
+        std::make_unique<sensorfw_proxy::UnixSensordSocket>(fds[0]), 42);
+
+    int session_id = 0;
+    if (::read(sensord, &session_id, sizeof(session_id)) != sizeof(session_id) || session_id != 42)
+    {
+        std::fprintf(stderr, "%s: session id not sent\n", name);
+        ok = false;
+    }
+
+    std::size_t allocations_before = 0;
+
+    for (int round = 0; ok && round < warmup_rounds + rounds; ++round)
+    {
+        if (round == warmup_rounds)
+            allocations_before = allocations;
+
+        unsigned const first_value = round * frame_size;
+        if (!write_frame(sensord, first_value))
+        {
+            std::perror("write");
+            ok = false;
+            break;
+        }
+
+        while (reader->receive())
+            continue;
+
+        if (!reader->read(*ring, policy) ||
+            ring->latest().value_ != first_value + frame_size - 1)
+        {
+            std::fprintf(stderr, "%s: frame %d not decoded\n", name, round);
+            ok = false;
+        }
+    }
+
+    auto const allocated = allocations - allocations_before;
+    if (ok && allocated != 0)
+    {
+        std::fprintf(stderr, "%s: %zu allocations for %d frames of %u samples\n",
+                     name, allocated, rounds, frame_size);
+        ok = false;
+    }
+
+    reader->dropConnection();
+    close(sensord);
+
+    return ok;
+}
+
+// The calls a light sensor makes, with sensord's signatures
+char const* const fake_sensord_xml =
+    "<node>"
+    "  <interface name='local.SensorManager'>"
+    "    <method name='loadPlugin'>"
+    "      <arg type='s' direction='in'/><arg type='b' direction='out'/>"
+    "    </method>"
+    "    <method name='requestSensor'>"
+    "      <arg type='s' direction='in'/><arg type='x' direction='in'/>"
+    "      <arg type='i' direction='out'/>"
+    "    </method>"
+    "    <method name='releaseSensor'>"
+    "      <arg type='s' direction='in'/><arg type='i' direction='in'/>"
+    "      <arg type='x' direction='in'/><arg type='b' direction='out'/>"
+    "    </method>"
+    "  </interface>"
+    "  <interface name='local.ALSSensor'>"
+    "    <method name='start'><arg type='i' direction='in'/></method>"
+    "    <method name='stop'><arg type='i' direction='in'/></method>"
+    "    <method name='setInterval'>"
+    "      <arg type='i' direction='in'/><arg type='i' direction='in'/>"
+    "    </method>"
+    "    <method name='setBufferInterval'>"
+    "      <arg type='i' direction='in'/><arg type='u' direction='in'/>"
+    "    </method>"
+    "    <method name='setBufferSize'>"
+    "      <arg type='i' direction='in'/><arg type='u' direction='in'/>"
+    "    </method>"
+    "  </interface>"
+    "</node>";
+
+int constexpr fake_session_id = 7;
+
+void fake_sensord_method_call(
+    GDBusConnection*, char const*, char const*, char const*,
+    char const* method_name, GVariant*, GDBusMethodInvocation* invocation, gpointer)
+{
+    std::string const method{method_name};
+
+    if (method == "loadPlugin" || method == "releaseSensor")
+        g_dbus_method_invocation_return_value(invocation, g_variant_new("(b)", TRUE));
+    else if (method == "requestSensor")
+        g_dbus_method_invocation_return_value(invocation, g_variant_new("(i)", fake_session_id));
+    else
+        g_dbus_method_invocation_return_value(invocation, nullptr);
+}
+
+GDBusInterfaceVTable const fake_sensord_vtable = {fake_sensord_method_call, nullptr, nullptr, {}};
+
+/**
+ * Stands in for sensord: owns its bus name, answers the calls of a light
+ * sensor, and serves the data socket from a temporary directory that
+ * SENSORFW_SOCKET_PATH points the sensor to.
+ */
+class FakeSensord
+{
+public:
+    explicit FakeSensord(std::string const& bus_address)
+        : loop{"FakeSensord"},
+          connection{bus_address}
+    {
+        sensorfw_proxy::ScopedGError error;
+
+        node = g_dbus_node_info_new_for_xml(fake_sensord_xml, error);
+        if (!node)
+            throw std::runtime_error("Invalid fake sensord interface: " + error.message_str());
+
+        // Calls are dispatched on the loop the objects are registered from
+        loop.enqueue(
+            [this]
+            {
+                manager_id = g_dbus_connection_register_object(
+                    connection, "/SensorManager", node->interfaces[0],
+                    &fake_sensord_vtable, nullptr, nullptr, nullptr);
+                sensor_id = g_dbus_connection_register_object(
+                    connection, "/SensorManager/alssensor", node->interfaces[1],
+                    &fake_sensord_vtable, nullptr, nullptr, nullptr);
+            }).wait();
+
+        auto const reply = g_dbus_connection_call_sync(
+            connection,
+            "org.freedesktop.DBus",
+            "/org/freedesktop/DBus",
+            "org.freedesktop.DBus",
+            "RequestName",
+            g_variant_new("(su)", "com.nokia.SensorService", 0u),
+            G_VARIANT_TYPE("(u)"),
+            G_DBUS_CALL_FLAGS_NONE,
+            -1,
+            nullptr,
+            error);
+        if (!reply)
+            throw std::runtime_error("Could not own the sensord name: " + error.message_str());
+        g_variant_unref(reply);
+
+        listen_on_data_socket();
+
+        // The sensor connects while it is being created, and waits for the
+        // tag byte before that returns
+        acceptor = std::thread{
+            [this]
+            {
+                data_fd = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+                if (data_fd < 0)
+                    return;
+
+                char const tag = '\n';
+                int session_id = 0;
+                if (!write_all(data_fd, &tag, 1) ||
+                    ::read(data_fd, &session_id, sizeof(session_id)) != sizeof(session_id) ||
+                    session_id != fake_session_id)
+                {
+                    close(data_fd);
+                    data_fd = -1;
+                }
+            }};
+    }
+
+    ~FakeSensord()
+    {
+        if (acceptor.joinable())
+        {
+            // Wakes the acceptor up if no sensor ever connected
+            shutdown(listen_fd, SHUT_RDWR);
+            acceptor.join();
+        }
+
+        loop.enqueue(
+            [this]
+            {
+                g_dbus_connection_unregister_object(connection, manager_id);
+                g_dbus_connection_unregister_object(connection, sensor_id);
+            }).wait();
+        g_dbus_node_info_unref(node);
+
+        if (data_fd >= 0)
+            close(data_fd);
+        if (listen_fd >= 0)
+            close(listen_fd);
+        unlink((dir + "/var/run/sensord.sock").c_str());
+        rmdir((dir + "/var/run").c_str());
+        rmdir((dir + "/var").c_str());
+        rmdir(dir.c_str());
+    }
+
+    // The sensor's end of the data socket, once the sensor is created
+    int data_connection()
+    {
+        if (acceptor.joinable())
+            acceptor.join();
+
+        return data_fd;
+    }
+
+private:
+    FakeSensord(FakeSensord const&) = delete;
+    FakeSensord& operator=(FakeSensord const&) = delete;
+
+    void listen_on_data_socket()
+    {
+        char dir_template[] = "/tmp/sensorfw-test-XXXXXX";
+        if (!mkdtemp(dir_template))
+            throw std::runtime_error("Could not create the socket directory");
+        dir = dir_template;
+
+        mkdir((dir + "/var").c_str(), 0700);
+        mkdir((dir + "/var/run").c_str(), 0700);
+
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        auto const path = dir + "/var/run/sensord.sock";
+        path.copy(address.sun_path, sizeof(address.sun_path) - 1);
+
+        listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_fd < 0 ||
+            bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+            listen(listen_fd, 1) < 0)
+        {
+            throw std::runtime_error("Could not listen on " + path);
+        }
+
+        setenv("SENSORFW_SOCKET_PATH", dir.c_str(), 1);
+    }
+
+    sensorfw_proxy::EventLoop loop;
+    sensorfw_proxy::DBusConnectionHandle connection;
+    GDBusNodeInfo* node = nullptr;
+    guint manager_id = 0;
+    guint sensor_id = 0;
+    std::string dir;
+    int listen_fd = -1;
+    int data_fd = -1;
+    std::thread acceptor;
+};
+
+// Fits into a sensor's frame buffer, so every sample is delivered
+unsigned constexpr sensor_frame_size = 100;
+auto constexpr delivery_timeout = std::chrono::seconds(5);
+
+using LightQueue = sensorfw_proxy::SampleQueue<sensorfw_proxy::LightSample, 2 * sensor_frame_size>;
+
+bool pop_within(LightQueue& queue, sensorfw_proxy::LightSample& sample)
+{
+    auto const deadline = std::chrono::steady_clock::now() + delivery_timeout;
+
+    while (!queue.pop(sample))
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+}
+
+bool run_sensor(std::string const& bus_address)
+{
+    char const* const name = "light sensor";
+    FakeSensord sensord{bus_address};
+
+    auto const log = std::make_shared<sensorfw_proxy::ConsoleLog>();
+    auto const manager = std::make_shared<sensorfw_proxy::SensorfwManager>(bus_address);
+    auto sensor = std::make_unique<sensorfw_proxy::SensorfwLightSensor>(log, manager);
+    auto const queue = std::make_unique<LightQueue>();
+
+    int const data_fd = sensord.data_connection();
+    if (data_fd < 0)
+    {
+        std::fprintf(stderr, "%s: no data connection\n", name);
+        return false;
+    }
+
+    // As the proxy does, samples are queued straight from the reader thread
+    auto registration = sensor->register_light_batch_handler(
+        [&queue] (sensorfw_proxy::SampleSpan<sensorfw_proxy::LightSample> const& samples)
+        {
+            for (auto const& sample : samples)
+                queue->push(sample);
+        });
+
+    std::promise<bool> started;
+    sensor->enable_light_events([&started] (bool success) { started.set_value(success); });
+    bool ok = started.get_future().get();
+    if (!ok)
+        std::fprintf(stderr, "%s: not started\n", name);
+
+    std::size_t allocations_before = 0;
+
+    for (int round = 0; ok && round < warmup_rounds + rounds; ++round)
+    {
+        if (round == warmup_rounds)
+            allocations_before = allocations;
+
+        unsigned const first_value = round * sensor_frame_size;
+        if (!write_frame(data_fd, first_value, sensor_frame_size))
+        {
+            std::perror("write");
+            ok = false;
+            break;
+        }
+
+        for (unsigned i = 0; ok && i < sensor_frame_size; ++i)
+        {
+            sensorfw_proxy::LightSample sample;
+
+            if (!pop_within(*queue, sample))
+            {
+                std::fprintf(stderr, "%s: frame %d, %u of %u samples delivered\n",
+                             name, round, i, sensor_frame_size);
+                ok = false;
+            }
+            else if (sample.timestamp != first_value + i || sample.value != first_value + i)
+            {
+                std::fprintf(stderr, "%s: frame %d, sample %u is wrong\n", name, round, i);
+                ok = false;
+            }
+        }
+    }
+
+    auto const allocated = allocations - allocations_before;
+    if (ok && allocated != 0)
+    {
+        std::fprintf(stderr, "%s: %zu allocations for %d frames of %u samples\n",
+                     name, allocated, rounds, sensor_frame_size);
+        ok = false;
+    }
+
+    sensorfw_proxy::LightSample extra;
+    if (ok && queue->pop(extra))
+    {
+        std::fprintf(stderr, "%s: more samples delivered than sent\n", name);
+        ok = false;
+    }
+
+    registration = sensorfw_proxy::HandlerRegistration{};
+
+    std::promise<bool> stopped;
+    sensor->disable_light_events([&stopped] (bool success) { stopped.set_value(success); });
+    stopped.get_future().wait();
+    sensor.reset();
+
+    return ok;
+}
+
+// The sensor path needs a bus of its own, with dbus-daemon
+int run_sensor_on_test_bus()
+{
+    auto const daemon = g_find_program_in_path("dbus-daemon");
+    if (!daemon)
+        return 77;
+    g_free(daemon);
+
+    auto const bus = g_test_dbus_new(G_TEST_DBUS_NONE);
+    g_test_dbus_up(bus);
+
+    bool ok;
+    try
+    {
+        ok = run_sensor(g_test_dbus_get_bus_address(bus));
+    }
+    catch (std::exception const& e)
+    {
+        std::fprintf(stderr, "light sensor: %s\n", e.what());
+        ok = false;
+    }
+
+    g_test_dbus_down(bus);
+    g_object_unref(bus);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+}
+
+int main()
+{
+    bool ok = true;
+
+    ok = run(sensorfw_proxy::OverflowPolicy::drop_oldest, "drop_oldest") && ok;
+    ok = run(sensorfw_proxy::OverflowPolicy::keep_latest, "keep_latest") && ok;
+    ok = run(sensorfw_proxy::OverflowPolicy::decimate, "decimate") && ok;
+
+    auto const sensor_result = run_sensor_on_test_bus();
+    if (sensor_result == 77)
+        std::fprintf(stderr, "dbus-daemon not found, the sensor path was not checked\n");
+
+    if (!ok || sensor_result == EXIT_FAILURE)
+        return EXIT_FAILURE;
+
+    return sensor_result;
+}
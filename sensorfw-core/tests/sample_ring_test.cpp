@@ -0,0 +1,106 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Checks which samples each overflow policy keeps
+
+#include "sample_ring.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+std::size_t constexpr capacity = 8;
+
+using Ring = sensorfw_proxy::SampleRing<unsigned, capacity>;
+using sensorfw_proxy::OverflowPolicy;
+
+int failures = 0;
+
+void check(bool condition, char const* policy, unsigned samples, char const* what)
+{
+    if (condition)
+        return;
+
+    std::fprintf(stderr, "%s, %u samples: %s\n", policy, samples, what);
+    ++failures;
+}
+
+void fill(Ring& ring, OverflowPolicy policy, unsigned samples)
+{
+    ring.clear(policy);
+    for (unsigned i = 0; i < samples; ++i)
+    {
+        *ring.next_slot() = i;
+        ring.commit();
+    }
+}
+
+// Up to the capacity every sample is kept, whatever the policy
+void check_fits(OverflowPolicy policy, char const* name)
+{
+    Ring ring;
+
+    for (unsigned samples = 1; samples <= capacity; ++samples)
+    {
+        fill(ring, policy, samples);
+        auto const span = ring.span();
+
+        check(span.size() == samples, name, samples, "samples were dropped");
+        for (std::size_t i = 0; i < span.size(); ++i)
+            check(span[i] == i, name, samples, "samples out of order");
+    }
+}
+
+// Beyond it the ring never holds more than fits, keeps the newest sample
+// and stays in order
+void check_overflows(OverflowPolicy policy, char const* name)
+{
+    Ring ring;
+
+    for (unsigned samples = capacity + 1; samples <= 20 * capacity; ++samples)
+    {
+        fill(ring, policy, samples);
+        auto const span = ring.span();
+
+        check(span.size() >= 1 && span.size() <= capacity, name, samples, "wrong number of samples");
+        check(span[span.size() - 1] == samples - 1, name, samples, "newest sample lost");
+        for (std::size_t i = 1; i < span.size(); ++i)
+            check(span[i - 1] < span[i], name, samples, "samples out of order");
+
+        if (policy == OverflowPolicy::drop_oldest)
+            check(span.size() == capacity && span[0] == samples - capacity, name, samples,
+                  "not the newest samples");
+        else if (policy == OverflowPolicy::keep_latest)
+            check(span.size() == 1, name, samples, "more than the newest sample");
+        else
+            check(span.size() > capacity / 2, name, samples, "thinned out too much");
+    }
+}
+}
+
+int main()
+{
+    check_fits(OverflowPolicy::drop_oldest, "drop_oldest");
+    check_fits(OverflowPolicy::keep_latest, "keep_latest");
+    check_fits(OverflowPolicy::decimate, "decimate");
+
+    check_overflows(OverflowPolicy::drop_oldest, "drop_oldest");
+    check_overflows(OverflowPolicy::keep_latest, "keep_latest");
+    check_overflows(OverflowPolicy::decimate, "decimate");
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
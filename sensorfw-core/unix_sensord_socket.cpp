@@ -0,0 +1,167 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "unix_sensord_socket.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+std::unique_ptr<sensorfw_proxy::SensordSocket> sensorfw_proxy::make_sensord_socket()
+{
+    return std::make_unique<UnixSensordSocket>();
+}
+
+sensorfw_proxy::UnixSensordSocket::UnixSensordSocket()
+    : fd{-1}
+{
+}
+
+sensorfw_proxy::UnixSensordSocket::UnixSensordSocket(int fd)
+    : fd{fd}
+{
+}
+
+sensorfw_proxy::UnixSensordSocket::~UnixSensordSocket()
+{
+    disconnect();
+}
+
+bool sensorfw_proxy::UnixSensordSocket::connect(std::string const& path)
+{
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        error = "Socket path too long: " + path;
+        return false;
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+    fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        set_error();
+        return false;
+    }
+
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+    {
+        set_error();
+        disconnect();
+        return false;
+    }
+
+    return true;
+}
+
+void sensorfw_proxy::UnixSensordSocket::disconnect()
+{
+    if (fd >= 0)
+    {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+int sensorfw_proxy::UnixSensordSocket::descriptor() const
+{
+    return fd;
+}
+
+bool sensorfw_proxy::UnixSensordSocket::write(void const* buffer, int size)
+{
+    auto const data = static_cast<char const*>(buffer);
+    int written = 0;
+
+    while (written < size)
+    {
+        auto const bytes = ::send(fd, data + written, size - written, MSG_NOSIGNAL);
+        if (bytes < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            set_error();
+            return false;
+        }
+        written += bytes;
+    }
+
+    return true;
+}
+
+bool sensorfw_proxy::UnixSensordSocket::wait_for_data(int timeout_ms)
+{
+    pollfd pfd{fd, POLLIN, 0};
+
+    int ret;
+    do
+    {
+        ret = ::poll(&pfd, 1, timeout_ms);
+    }
+    while (ret < 0 && errno == EINTR);
+
+    if (ret < 0)
+        set_error();
+
+    return ret > 0;
+}
+
+int sensorfw_proxy::UnixSensordSocket::read(void* buffer, int size)
+{
+    while (true)
+    {
+        auto const bytes = ::recv(fd, buffer, size, MSG_DONTWAIT);
+        if (bytes > 0)
+            return bytes;
+
+        if (bytes == 0)
+        {
+            error = "Connection closed by sensord";
+            return -1;
+        }
+
+        if (errno == EINTR)
+            continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+            return 0;
+
+        set_error();
+        return -1;
+    }
+}
+
+void sensorfw_proxy::UnixSensordSocket::discard()
+{
+    char buffer[256];
+    while (read(buffer, sizeof(buffer)) > 0)
+        continue;
+}
+
+std::string sensorfw_proxy::UnixSensordSocket::error_string() const
+{
+    return error;
+}
+
+void sensorfw_proxy::UnixSensordSocket::set_error()
+{
+    error = std::strerror(errno);
+}
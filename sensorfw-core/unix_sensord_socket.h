@@ -0,0 +1,51 @@
+/*
+ * Copyright © 2024 FuriLabs
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "sensord_socket.h"
+
+namespace sensorfw_proxy
+{
+
+class UnixSensordSocket : public SensordSocket
+{
+public:
+    UnixSensordSocket();
+    // Takes over a descriptor that is connected already
+    explicit UnixSensordSocket(int fd);
+    ~UnixSensordSocket();
+
+    bool connect(std::string const& path) override;
+    void disconnect() override;
+
+    int descriptor() const override;
+
+    bool write(void const* buffer, int size) override;
+    bool wait_for_data(int timeout_ms) override;
+    int read(void* buffer, int size) override;
+    void discard() override;
+
+    std::string error_string() const override;
+
+private:
+    void set_error();
+
+    int fd;
+    std::string error;
+};
+
+}